@@ -0,0 +1,57 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <QObject>
+#include <QVariant>
+#include <QJSValue>
+#include <QJSValueList>
+#include <QmlFutures/Tools.h>
+#include <QmlFutures/QF.h>
+#include <QmlFutures/Condition.h>
+
+namespace QmlFutures {
+
+//
+// Invokes JS handlers of QmlFutures.
+// Disabled by default (budget 0): handlers are called synchronously.
+// Otherwise non-immediate handlers are queued and drained within 'budget' ms per frame
+// (on QQuickWindow::afterAnimating if window is set, on next event loop pass if not).
+// Leftovers are carried to the next frame, 'Idle' ones run only when 'Normal' queue is empty.
+//
+
+class Dispatcher : public QObject
+{
+    Q_OBJECT
+public:
+    Dispatcher();
+    ~Dispatcher() override;
+
+    qreal budget() const;
+    void setBudget(qreal value);
+    QObject* window() const;
+    void setWindow(QObject* value);
+
+    // Invocation with 'priority' would be queued, not called right away
+    bool isQueued(QF::DispatchPriority priority) const;
+
+    // Queued invocation with non-zero 'subscription' can be dropped by cancel(subscription)
+    void dispatch(QF::DispatchPriority priority, const QJSValue& handler, const QJSValueList& args, const ConditionPtr& condition, int subscription = 0);
+    bool cancel(int subscription);
+    int pendingCount() const;
+
+    // { buckets: [upper bounds, ms], latency: [counts], frameTime: [counts], pending: int }
+    QVariantMap stats() const;
+    void resetStats();
+
+private:
+    void scheduleDrain();
+    void onFrame();
+    void drain(bool all);
+
+private:
+    QF_DECLARE_PIMPL
+};
+
+} // namespace QmlFutures
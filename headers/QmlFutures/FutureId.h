@@ -0,0 +1,103 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <QVariant>
+#include <QFuture>
+#include <QFutureInterface>
+#include <QHash>
+#include <type_traits>
+
+namespace QmlFutures {
+
+namespace Internal {
+
+// Caller guarantees that 'future' holds exactly QFuture<T> (checked by typeId in Init)
+template<typename T>
+inline const QFuture<T>& futureRef(const QVariant& future)
+{
+    return *reinterpret_cast<const QFuture<T>*>(future.constData());
+}
+
+// Shared state behind QFuture<T> (all copies of the future point to the same one)
+template<typename T>
+inline const QFutureInterfaceBase& futureInterface(const QFuture<T>& future)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    return QFutureInterfaceBase::get(const_cast<QFuture<T>&>(future));
+#else
+    static_assert(!std::is_same<T, void>::value, "Qt5 QFuture<void> keeps its shared state private");
+    return future.d;
+#endif
+}
+
+} // namespace Internal
+
+//
+// Identity of the state shared by all copies of some QFuture<T>.
+// Qt5 compares futures by d-pointer, Qt6 doesn't compare them at all,
+// so the address of the shared result store is used as a key for both.
+// QFuture<void> converted from QFuture<T> shares the state, so the key is paired with metatype id of QFuture<T>.
+// Exception: Qt5 QFuture<void> doesn't expose its shared state, it has null identity
+// and its observer (FutureWrapper) stands for it, see Init::futureId.
+//
+
+class FutureId
+{
+public:
+    FutureId() = default;
+
+    template<typename T>
+    static FutureId of(const QFuture<T>& future) {
+#if QT_VERSION < QT_VERSION_CHECK(6,0,0)
+        if constexpr (std::is_same<T, void>::value) {
+            (void)future;
+            return FutureId();
+        } else
+#endif
+        return FutureId(qMetaTypeId<QFuture<T>>(), &Internal::futureInterface(future).resultStoreBase());
+    }
+
+    // For future without identity of its own: keyed by the only object observing it
+    template<typename T>
+    static FutureId ofObserver(const QFuture<T>&, const void* observer) {
+        return FutureId(qMetaTypeId<QFuture<T>>(), observer);
+    }
+
+    template<typename T>
+    static FutureId fromVariant(const QVariant& future) {
+        return of(Internal::futureRef<T>(future));
+    }
+
+    bool isNull() const { return !m_key; }
+    int typeId() const { return m_typeId; }
+    const void* key() const { return m_key; }
+
+    // Same shared state, maybe seen through QFuture of another type: canceling one cancels both
+    bool sharesState(const FutureId& other) const { return m_key == other.m_key; }
+
+    bool operator==(const FutureId& other) const { return m_key == other.m_key && m_typeId == other.m_typeId; }
+    bool operator!=(const FutureId& other) const { return !(*this == other); }
+
+private:
+    FutureId(int typeId, const void* key)
+        : m_typeId(typeId),
+          m_key(key)
+    { }
+
+private:
+    int m_typeId { 0 };
+    const void* m_key { nullptr };
+};
+
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+inline size_t qHash(const FutureId& id, size_t seed = 0) noexcept
+#else
+inline uint qHash(const FutureId& id, uint seed = 0) noexcept
+#endif
+{
+    return ::qHash(id.key(), seed) ^ ::qHash(id.typeId(), seed);
+}
+
+} // namespace QmlFutures
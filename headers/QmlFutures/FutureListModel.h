@@ -0,0 +1,75 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <QAbstractListModel>
+#include <QVariant>
+#include <QmlFutures/Tools.h>
+
+namespace QmlFutures {
+
+//
+// Exposed to QML.
+// List of futures with their state as roles: no QmlFutureWatcher per row is needed.
+// Each distinct future is still observed by its FutureWrapper and QFutureWatcher (shared with other observers).
+// Rows which changed within one update interval are reported by dataChanged of contiguous ranges.
+//
+
+class FutureListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    friend class Init;
+public:
+    enum Roles {
+        FutureRole = Qt::UserRole + 1,
+        StateRole,
+        ResultRole,
+        ResultConvertedRole,
+        IsFinishedRole,
+        ProgressRole
+    };
+    Q_ENUM(Roles);
+
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(int updateInterval READ updateInterval WRITE setUpdateInterval NOTIFY updateIntervalChanged)
+
+    explicit FutureListModel(QObject* parent = nullptr);
+    ~FutureListModel() override;
+
+    Q_INVOKABLE void append(const QVariant& future);
+    Q_INVOKABLE void appendAll(const QVariantList& futures);
+    Q_INVOKABLE void insert(int row, const QVariant& future);
+    Q_INVOKABLE void remove(int row, int count = 1);
+    Q_INVOKABLE void clear();
+    Q_INVOKABLE QVariant future(int row) const;
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+signals:
+    void countChanged(int count);
+
+// --- Properties support ---
+public:
+    int count() const;
+    int updateInterval() const;
+
+public slots:
+    void setUpdateInterval(int value);
+
+signals:
+    void updateIntervalChanged(int updateInterval);
+// --- ---
+
+private:
+    static void registerTypes();
+    void insertFutures(int row, const QVariantList& futures);
+    void flush();
+
+private:
+    QF_DECLARE_PIMPL
+};
+
+} // namespace QmlFutures
@@ -7,12 +7,120 @@
 #include <QVariant>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <cassert>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
 #include <QmlFutures/Metatypes.h>
 #include <QmlFutures/QF.h>
+#include <QmlFutures/FutureId.h>
 
 namespace QmlFutures {
 
+class FutureWrapper;
+
+namespace Internal {
+
+// Maps shared state of the future to QF::WatcherState from single read of its state flags,
+// so state reported concurrently by worker thread is never observed half-applied
+QF::WatcherState watcherState(const QFutureInterfaceBase& interface);
+
+#if QT_VERSION < QT_VERSION_CHECK(6,0,0)
+// Qt5 QFuture<void> doesn't expose its shared state: the same mapping through public queries
+QF::WatcherState watcherState(const QFuture<void>& future);
+#endif
+
+struct ProgressInfo
+{
+    int value { 0 };
+    int minimum { 0 };
+    int maximum { 0 };
+    QString text;
+
+    bool operator==(const ProgressInfo& other) const {
+        return value == other.value && minimum == other.minimum && maximum == other.maximum && text == other.text;
+    }
+
+    bool operator!=(const ProgressInfo& other) const { return !(*this == other); }
+};
+
+inline ProgressInfo progressInfo(const QFutureInterfaceBase& interface)
+{
+    return {interface.progressValue(), interface.progressMinimum(), interface.progressMaximum(), interface.progressText()};
+}
+
+template<typename T>
+QF::WatcherState stateOf(const QFuture<T>& future)
+{
+#if QT_VERSION < QT_VERSION_CHECK(6,0,0)
+    if constexpr (std::is_same<T, void>::value)
+        return watcherState(future);
+    else
+#endif
+    return watcherState(futureInterface(future));
+}
+
+template<typename T>
+ProgressInfo progressInfoOf(const QFuture<T>& future)
+{
+#if QT_VERSION < QT_VERSION_CHECK(6,0,0)
+    if constexpr (std::is_same<T, void>::value)
+        return {future.progressValue(), future.progressMinimum(), future.progressMaximum(), future.progressText()};
+    else
+#endif
+    return progressInfo(futureInterface(future));
+}
+
+// Progress normalized to [0..1], finished future is complete regardless of reported values
+template<typename T>
+qreal progressOf(const QFuture<T>& future)
+{
+    if (future.isFinished())
+        return 1;
+
+    const int range = future.progressMaximum() - future.progressMinimum();
+    return range > 0 ? qreal(future.progressValue() - future.progressMinimum()) / range : 0;
+}
+
+// Results [begin, end) of multi-result future, each one passed through 'convert'
+template<typename T, typename Convert>
+QVariantList resultsOf(const QFuture<T>& future, int begin, int end, const Convert& convert)
+{
+    QVariantList results;
+    results.reserve(end - begin);
+    for (int i = begin; i < end; i++)
+        results.append(convert(future.resultAt(i)));
+    return results;
+}
+
+} // namespace Internal
+
+//
+// Per-type operations on QFuture<T> stored in QVariant.
+// One static table per type (see FutureOpsT), looked up by Init by metatype id.
+// Queries are allocation-free: they read the QFuture<T> in place.
+//
+
+struct FutureOps
+{
+    FutureId (*identity)(const QVariant& future);
+    bool (*isStarted)(const QVariant& future);
+    bool (*isRunning)(const QVariant& future);
+    bool (*isPaused)(const QVariant& future);
+    bool (*isFinished)(const QVariant& future);
+    bool (*isCanceled)(const QVariant& future);
+    QF::WatcherState (*state)(const QVariant& future);
+    QVariant (*resultVariant)(const QVariant& future);
+    QVariant (*resultConverted)(const QVariant& future, const void* converter);
+    int (*resultCount)(const QVariant& future);
+    QVariantList (*resultsVariant)(const QVariant& future, int begin, int end);
+    QVariantList (*resultsConverted)(const QVariant& future, int begin, int end, const void* converter);
+    Internal::ProgressInfo (*progressInfo)(const QVariant& future);
+    bool (*equals)(const QVariant& a, const QVariant& b); // For futures without identity, see FutureId
+    std::shared_ptr<FutureWrapper> (*createWrapper)(const QVariant& future, const void* converter);
+};
+
 //
 // Abstraction of QFuture<T> for QmlFutures.
 //
@@ -24,7 +132,11 @@ class FutureWrapper : public QObject
 {
     Q_OBJECT
 public:
-    virtual ~FutureWrapper() = default;
+    ~FutureWrapper() override;
+    // Re-targets wrapper to another QFuture of the same type, keeping its storage and QFutureWatcher.
+    // Only for wrapper which isn't shared (see Init::rebindFutureWrapper). False if type differs.
+    virtual bool rebind(const QVariant& future) = 0;
+    FutureId id() const { return m_id; }
     virtual bool isStarted() const = 0;
     virtual bool isRunning() const = 0;
     virtual bool isPaused() const = 0;
@@ -34,32 +146,75 @@ public:
     virtual QVariant getFuture() const = 0;
     virtual QVariant resultVariant() const = 0;
     virtual QVariant resultConverted() const = 0;
+    virtual int resultCount() const = 0;
+    virtual QVariantList resultsVariant(int begin, int end) const = 0;   // [begin, end)
+    virtual QVariantList resultsConverted(int begin, int end) const = 0; // [begin, end)
     virtual std::shared_ptr<QFutureWatcherBase> getWatcher() const = 0;
-    QF::WatcherState getState() const;
+    virtual QF::WatcherState getState() const = 0;
+    virtual qreal progress() const = 0;
+    virtual Internal::ProgressInfo progressInfo() const = 0;
     virtual void wait() = 0;
     void waitEL();
+    virtual void cancel() = 0; // QFuture::cancel(), works only if producer supports cancellation
+
+    // Enables resultsReady(), it's forwarded only for wrappers somebody streams results from.
+    void observeResults();
 
 signals:
     void stateChanged();
+    void progressChanged(); // Value, range or text
+    void resultsReady(int begin, int end);
+    void released(FutureId id); // From destructor
 
 protected:
+    // One QFutureWatcher per future. QFuture::then isn't used: Qt6 keeps one continuation per future,
+    // so ours and one chained by the future's owner would silently replace each other.
+    template<typename T>
+    void observe(QFuture<T>& future, std::shared_ptr<QFutureWatcher<T>>& watcher) {
+        watcher = std::make_shared<QFutureWatcher<T>>();
+        connect(*watcher);
+        watcher->setFuture(future);
+    }
+
+    // Finished future doesn't notify anymore, so it isn't subscribed to (no callout events).
+    // Then watcher keeps previous future until next retarget, its late notifications are deduplicated.
+    template<typename T>
+    void retarget(QFuture<T>& future, std::shared_ptr<QFutureWatcher<T>>& watcher) {
+        assert(watcher);
+        m_id = FutureId::of(future);
+        m_lastState = getState();
+
+        if (m_lastState == QF::WatcherState::FinishedFulfilled || m_lastState == QF::WatcherState::FinishedCanceled)
+            return;
+
+        watcher->setFuture(future);
+    }
+
     void connect(QFutureWatcherBase& watcher) const {
         QObject::connect(&watcher, &QFutureWatcherBase::started,  this, &FutureWrapper::onStateChanged);
         QObject::connect(&watcher, &QFutureWatcherBase::finished, this, &FutureWrapper::onStateChanged);
         QObject::connect(&watcher, &QFutureWatcherBase::paused,   this, &FutureWrapper::onStateChanged);
         QObject::connect(&watcher, &QFutureWatcherBase::resumed,  this, &FutureWrapper::onStateChanged);
+        QObject::connect(&watcher, &QFutureWatcherBase::progressValueChanged, this, &FutureWrapper::progressChanged);
+        QObject::connect(&watcher, &QFutureWatcherBase::progressRangeChanged, this, &FutureWrapper::progressChanged);
+        QObject::connect(&watcher, &QFutureWatcherBase::progressTextChanged,  this, &FutureWrapper::progressChanged);
     }
 
-private:
     void onStateChanged() {
-        if (m_lastState != getState()) {
-            m_lastState = getState();
+        const auto state = getState();
+
+        if (m_lastState != state) {
+            m_lastState = state;
             emit stateChanged();
         }
     }
 
+protected:
+    FutureId m_id;
+
 private:
     QF::WatcherState m_lastState { QF::WatcherState::Uninitialized };
+    bool m_resultsObserved { false };
 };
 
 
@@ -71,9 +226,19 @@ public:
         : m_future(future.value<QFuture<T>>()),
           m_converter(converter)
     {
-        m_watcher = std::make_shared<QFutureWatcher<T>>();
-        connect(*m_watcher);
-        m_watcher->setFuture(m_future);
+        m_id = FutureId::of(m_future);
+        observe(m_future, m_watcher);
+    }
+
+    bool rebind(const QVariant& future) override {
+        if (future.userType() != qMetaTypeId<QFuture<T>>())
+            return false;
+
+        m_future = Internal::futureRef<T>(future);
+        m_resultVariant.reset();
+        m_resultConverted.reset();
+        retarget(m_future, m_watcher);
+        return true;
     }
 
     //~FutureWrapper() override;
@@ -85,15 +250,44 @@ public:
     bool isCanceled() const override { return m_future.isCanceled(); }
     T result() const { return m_future.result(); }
     QVariant getFuture() const override { return QVariant::fromValue(m_future); }
-    QVariant resultVariant() const override { return isCanceled() ? QVariant() : QVariant::fromValue(m_future.result()); }
-    QVariant resultConverted() const override { return isCanceled() ? QVariant() : m_converter(result()); };
     std::shared_ptr<QFutureWatcherBase> getWatcher() const override { return m_watcher; }
+    QF::WatcherState getState() const override { return Internal::stateOf(m_future); }
+    qreal progress() const override { return Internal::progressOf(m_future); }
+    Internal::ProgressInfo progressInfo() const override { return Internal::progressInfoOf(m_future); }
     void wait() override { m_future.waitForFinished(); };
+    void cancel() override { m_future.cancel(); }
+
+    // Result of finished future is converted once and shared by all observers of this wrapper
+    QVariant resultVariant() const override {
+        if (isCanceled()) return QVariant();
+        if (!isFinished()) return QVariant::fromValue(m_future.result());
+        if (!m_resultVariant) m_resultVariant = QVariant::fromValue(m_future.result());
+        return *m_resultVariant;
+    }
+
+    QVariant resultConverted() const override {
+        if (isCanceled()) return QVariant();
+        if (!isFinished()) return m_converter(result());
+        if (!m_resultConverted) m_resultConverted = m_converter(result());
+        return *m_resultConverted;
+    }
+
+    int resultCount() const override { return m_future.resultCount(); }
+
+    QVariantList resultsVariant(int begin, int end) const override {
+        return Internal::resultsOf(m_future, begin, end, [](const T& x){ return QVariant::fromValue(x); });
+    }
+
+    QVariantList resultsConverted(int begin, int end) const override {
+        return Internal::resultsOf(m_future, begin, end, m_converter);
+    }
 
 private:
     QFuture<T> m_future;
     Converter<T> m_converter;
     std::shared_ptr<QFutureWatcher<T>> m_watcher;
+    mutable std::optional<QVariant> m_resultVariant;
+    mutable std::optional<QVariant> m_resultConverted;
 };
 
 
@@ -104,9 +298,27 @@ public:
     FutureWrapperT(const QVariant& future)
         : m_future(future.value<QFuture<void>>())
     {
-        m_watcher = std::make_shared<QFutureWatcher<void>>();
-        connect(*m_watcher);
-        m_watcher->setFuture(m_future);
+        m_id = FutureId::of(m_future);
+
+        // Qt5: future has no identity, this wrapper stands for it (see FutureId)
+        if (m_id.isNull())
+            m_id = FutureId::ofObserver(m_future, this);
+
+        observe(m_future, m_watcher);
+    }
+
+    bool rebind(const QVariant& future) override {
+        if (future.userType() != qMetaTypeId<QFuture<void>>())
+            return false;
+
+#if QT_VERSION < QT_VERSION_CHECK(6,0,0)
+        // Identity is this wrapper itself, it can't follow another future
+        return false;
+#else
+        m_future = Internal::futureRef<void>(future);
+        retarget(m_future, m_watcher);
+        return true;
+#endif
     }
 
     //~FutureWrapper() override;
@@ -119,12 +331,127 @@ public:
     QVariant getFuture() const override { return QVariant::fromValue(m_future); }
     QVariant resultVariant() const override { return QVariant::fromValue(nullptr); }
     QVariant resultConverted() const override { return QVariant::fromValue(nullptr); };
+    int resultCount() const override { return 0; }
+    QVariantList resultsVariant(int, int) const override { return {}; }
+    QVariantList resultsConverted(int, int) const override { return {}; }
     std::shared_ptr<QFutureWatcherBase> getWatcher() const override { return m_watcher; }
+    QF::WatcherState getState() const override { return Internal::stateOf(m_future); }
+    qreal progress() const override { return Internal::progressOf(m_future); }
+    Internal::ProgressInfo progressInfo() const override { return Internal::progressInfoOf(m_future); }
     void wait() override { m_future.waitForFinished(); };
+    void cancel() override { m_future.cancel(); }
 
 private:
     QFuture<void> m_future;
     std::shared_ptr<QFutureWatcher<void>> m_watcher;
 };
 
+
+template<typename T>
+class FutureOpsT
+{
+public:
+    static const FutureOps* ops() {
+        static const FutureOps instance {
+            &FutureId::fromVariant<T>,
+            &isStarted,
+            &isRunning,
+            &isPaused,
+            &isFinished,
+            &isCanceled,
+            &state,
+            &resultVariant,
+            &resultConverted,
+            &resultCount,
+            &resultsVariant,
+            &resultsConverted,
+            &progressInfo,
+            &equals,
+            &createWrapper
+        };
+
+        return &instance;
+    }
+
+private:
+    static const QFuture<T>& ref(const QVariant& future) { return Internal::futureRef<T>(future); }
+    static bool isStarted(const QVariant& future) { return ref(future).isStarted(); }
+    static bool isRunning(const QVariant& future) { return ref(future).isRunning(); }
+    static bool isPaused(const QVariant& future) { return ref(future).isPaused(); }
+    static bool isFinished(const QVariant& future) { return ref(future).isFinished(); }
+    static bool isCanceled(const QVariant& future) { return ref(future).isCanceled(); }
+
+    static QF::WatcherState state(const QVariant& future) { return Internal::stateOf(ref(future)); }
+    static Internal::ProgressInfo progressInfo(const QVariant& future) { return Internal::progressInfoOf(ref(future)); }
+
+    static bool equals(const QVariant& a, const QVariant& b) {
+#if QT_VERSION < QT_VERSION_CHECK(6,0,0)
+        return ref(a) == ref(b);
+#else
+        return FutureId::fromVariant<T>(a) == FutureId::fromVariant<T>(b);
+#endif
+    }
+
+    static QVariant resultVariant(const QVariant& future) {
+        if constexpr (std::is_same<T, void>::value) {
+            return QVariant::fromValue(nullptr);
+        } else {
+            const auto& f = ref(future);
+            return f.isCanceled() ? QVariant() : QVariant::fromValue(f.result());
+        }
+    }
+
+    static QVariant resultConverted(const QVariant& future, const void* converter) {
+        if constexpr (std::is_same<T, void>::value) {
+            (void)future;
+            (void)converter;
+            return QVariant::fromValue(nullptr);
+        } else {
+            const auto& f = ref(future);
+            return f.isCanceled() ? QVariant() : (*static_cast<const Converter<T>*>(converter))(f.result());
+        }
+    }
+
+    static int resultCount(const QVariant& future) {
+        if constexpr (std::is_same<T, void>::value) {
+            (void)future;
+            return 0;
+        } else {
+            return ref(future).resultCount();
+        }
+    }
+
+    static QVariantList resultsVariant(const QVariant& future, int begin, int end) {
+        if constexpr (std::is_same<T, void>::value) {
+            (void)future;
+            (void)begin;
+            (void)end;
+            return {};
+        } else {
+            return Internal::resultsOf(ref(future), begin, end, [](const T& x){ return QVariant::fromValue(x); });
+        }
+    }
+
+    static QVariantList resultsConverted(const QVariant& future, int begin, int end, const void* converter) {
+        if constexpr (std::is_same<T, void>::value) {
+            (void)future;
+            (void)begin;
+            (void)end;
+            (void)converter;
+            return {};
+        } else {
+            return Internal::resultsOf(ref(future), begin, end, *static_cast<const Converter<T>*>(converter));
+        }
+    }
+
+    static std::shared_ptr<FutureWrapper> createWrapper(const QVariant& future, const void* converter) {
+        if constexpr (std::is_same<T, void>::value) {
+            (void)converter;
+            return std::make_shared<FutureWrapperT<void>>(future);
+        } else {
+            return std::make_shared<FutureWrapperT<T>>(future, *static_cast<const Converter<T>*>(converter));
+        }
+    }
+};
+
 } // namespace QmlFutures
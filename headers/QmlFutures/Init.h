@@ -9,9 +9,11 @@
 #include <QFutureWatcher>
 #include <cassert>
 #include <functional>
+#include <memory>
 #include <QmlFutures/Tools.h>
 #include <QmlFutures/QF.h>
 #include <QmlFutures/FutureWrapper.h>
+#include <QmlFutures/FutureId.h>
 
 class QQmlEngine;
 
@@ -36,12 +38,7 @@ public:
         qRegisterMetaType<T>();
         auto typeId = qRegisterMetaType<QFuture<T>>();
 
-        auto factoryMethod = [converter](const QVariant& future) -> std::shared_ptr<FutureWrapper> {
-            auto wrapper = std::make_shared<FutureWrapperT<T>>(future, converter);
-            return wrapper;
-        };
-
-        registerType(typeId, factoryMethod);
+        registerType(typeId, FutureOpsT<T>::ops(), std::make_shared<const Converter<T>>(converter));
     }
 
     template <typename T,
@@ -56,23 +53,34 @@ public:
     inline void registerType() {
         auto typeId = qRegisterMetaType<QFuture<T>>();
 
-        auto factoryMethod = [](const QVariant& future) -> std::shared_ptr<FutureWrapper> {
-            auto wrapper = std::make_shared<FutureWrapperT<void>>(future);
-            return wrapper;
-        };
-
-        registerType(typeId, factoryMethod);
+        registerType(typeId, FutureOpsT<void>::ops(), nullptr);
     }
 
+    // Wrappers are interned by FutureId: all observers of one future share one wrapper
+    // (and so one QFutureWatcher and one result snapshot). Disconnect from it explicitly.
     std::shared_ptr<FutureWrapper> createFutureWrapper(const QVariant& unknownFuture);
+    // Re-targets 'wrapper' to 'unknownFuture' in place if nobody else holds it, otherwise replaces it.
+    // Returns true if the same wrapper object is kept (so existing connections to it stay valid).
+    bool rebindFutureWrapper(std::shared_ptr<FutureWrapper>& wrapper, const QVariant& unknownFuture);
+    // Cancels the future if 'wrapper' is its last observer (nobody else holds the wrapper) and it isn't finished.
+    // Call before releasing own reference. Returns true if canceled.
+    bool cancelIfUnobserved(const std::shared_ptr<FutureWrapper>& wrapper);
+    // Cancels unfinished future regardless of other observers
+    void cancelFuture(const std::shared_ptr<FutureWrapper>& wrapper);
+    // Called when future 'id' is canceled by cancelIfUnobserved / cancelFuture, lets producer (QF) release its own sources
+    void setCancelHook(const FutureId& id, const std::function<void()>& hook);
+    void removeCancelHook(const FutureId& id);
     bool isSupportedFuture(const QVariant& unknownFuture) const;
+    FutureId futureId(const QVariant& unknownFuture) const;
+    const FutureOps& futureOps(const QVariant& unknownFuture) const;
+    QVariant resultConverted(const QVariant& unknownFuture) const;
+    QVariantList resultsConverted(const QVariant& unknownFuture, int begin, int end) const;
     static bool isCondition(const QVariant& value);
     static bool isNull(const QVariant& value);
 
 private:
-    using FactoryMethod = std::function<std::shared_ptr<FutureWrapper>(const QVariant& future)>;
-
-    void registerType(int typeId, const FactoryMethod& converter);
+    // 'converter' is Converter<T> for non-void T, ops know how to call it
+    void registerType(int typeId, const FutureOps* ops, const std::shared_ptr<const void>& converter);
 
 private:
     QF_DECLARE_PIMPL
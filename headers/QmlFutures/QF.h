@@ -42,6 +42,29 @@ public:
     };
     Q_ENUM(CombineTrigger);
 
+    // Used by QmlFutures handlers, makes difference only if dispatch budget is set
+    enum class DispatchPriority {
+        Immediate,
+        Normal,
+        Idle
+    };
+    Q_ENUM(DispatchPriority);
+
+    // How QmlFutureWatcher receives state changes of its future
+    enum class DeliveryMode {
+        Queued,    // Via event loop, one event per change
+        Direct,    // Right away, in the thread which reports the change (GUI thread)
+        Coalesced  // Via event loop, burst of changes is merged into one transition
+    };
+    Q_ENUM(DeliveryMode);
+
+    // What QmlFutureWatcher does with unfinished future when another one is set
+    enum class SupersedePolicy {
+        Keep,  // Keeps running
+        Cancel // Canceled, even if somebody else observes it
+    };
+    Q_ENUM(SupersedePolicy);
+
 public:
     QF();
     ~QF() override;
@@ -51,7 +74,8 @@ public:
     Q_INVOKABLE QVariant createFuture(const QVariant& fulfilTrigger, const QVariant& cancelTrigger);
     Q_INVOKABLE QVariant createTimedFuture(const QVariant& result, int time);
     Q_INVOKABLE QVariant createTimedCanceledFuture(int time);
-    Q_INVOKABLE QVariant combine(QF::CombineTrigger trigger, const QVariant& context, const QVariant& sources);
+    // Result reports progress [0..1000]: weighted mean of sources for 'All', most advanced source for 'Any'
+    Q_INVOKABLE QVariant combine(QF::CombineTrigger trigger, const QVariant& context, const QVariant& sources, const QVariantList& weights = QVariantList());
 
 private:
     static void registerTypes();
@@ -61,7 +85,6 @@ private:
     struct TimedFutureCtx;
     using FutureCtxPtr = std::shared_ptr<QF::FutureCtx>;
     using CombineCtxPtr = std::shared_ptr<QF::CombineCtx>;
-    using TimedFutureCtxPtr = std::shared_ptr<QF::TimedFutureCtx>;
 
 private:
     static bool isNull(const QVariant& value);
@@ -70,12 +93,18 @@ private:
     static bool isCanceled(const QVariant& value);
     static bool isFulfilled(const QVariant& value);
 
-    void recheckFulfilCond(FutureCtx*);
-    void recheckCancelCond(FutureCtx*);
-    void finishTimedFuture(TimedFutureCtx*);
-    void recheckFutureCond(FutureCtx*);
-    void recheckFutureCancelCond(FutureCtx*);
-    void recheckCombineCtx(CombineCtx*);
+    void recheckFulfilCond(Internal::SlotHandle handle);
+    void recheckCancelCond(Internal::SlotHandle handle);
+    void scheduleTimedFuture(TimedFutureCtx&& ctx);
+    void finishTimedFutures();
+    void recheckFutureCond(Internal::SlotHandle handle);
+    void recheckFutureCancelCond(Internal::SlotHandle handle);
+    void recheckCombineCtx(Internal::SlotHandle handle, int sourceIndex);
+    void cancelFutureCtx(Internal::SlotHandle handle);
+    void cancelCombineCtx(Internal::SlotHandle handle);
+    void recheckCombineProgress(Internal::SlotHandle handle, int sourceIndex);
+    void scheduleCombineProgress(CombineCtx& ctx);
+    void flushCombineProgress();
 
 private:
     QF_DECLARE_PIMPL
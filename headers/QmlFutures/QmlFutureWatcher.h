@@ -5,6 +5,7 @@
 #pragma once
 #include <QObject>
 #include <QVariant>
+#include <QQmlParserStatus>
 #include <QmlFutures/Tools.h>
 #include <QmlFutures/QF.h>
 
@@ -14,10 +15,22 @@ namespace QmlFutures {
 // Exposed to QML.
 // Allows to create QmlFutureWatcher in QML and handle QFuture<T>
 //
+// Supports delegate pools of ListView / TableView with 'reuseItems: true':
+// between pool() and reuse() the watcher is dormant, 'future' set meanwhile is applied by reuse()
+// in place, as single transition (wrapper is re-targeted, no uninitialized() / initialized()).
+// Setting another non-null future to initialized watcher is the same single transition.
+// Hooked automatically to 'pooled' / 'reused' signals of ListView / GridView / TableView attached object
+// of the delegate it belongs to (Qt 5.14+).
+//
+// With 'cancelWhenUnobserved' the future is canceled when watcher leaves it unfinished (other future is set,
+// watcher is destroyed) and nobody else observes it. With 'supersedePolicy: QF.Cancel' unfinished future
+// is canceled when another one is set, regardless of other observers (latest-only).
+//
 
-class QmlFutureWatcher : public QObject
+class QmlFutureWatcher : public QObject, public QQmlParserStatus
 {
     Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
     friend class Init;
 public:
     Q_PROPERTY(QVariant future READ future WRITE setFuture NOTIFY futureChanged)
@@ -27,10 +40,25 @@ public:
     Q_PROPERTY(bool isFinished READ isFinished NOTIFY isFinishedChanged)
     Q_PROPERTY(bool isCanceled READ isCanceled NOTIFY isCanceledChanged)
     Q_PROPERTY(bool isFulfilled READ isFulfilled NOTIFY isFulfilledChanged)
+    Q_PROPERTY(int deliveryMode READ deliveryModeInt WRITE setDeliveryModeInt NOTIFY deliveryModeChanged)
+    Q_PROPERTY(int progress READ progress NOTIFY progressChanged)
+    Q_PROPERTY(int progressMin READ progressMin NOTIFY progressMinChanged)
+    Q_PROPERTY(int progressMax READ progressMax NOTIFY progressMaxChanged)
+    Q_PROPERTY(QString progressText READ progressText NOTIFY progressTextChanged)
+    Q_PROPERTY(qreal progressRate READ progressRate WRITE setProgressRate NOTIFY progressRateChanged)
+    Q_PROPERTY(bool cancelWhenUnobserved READ cancelWhenUnobserved WRITE setCancelWhenUnobserved NOTIFY cancelWhenUnobservedChanged)
+    Q_PROPERTY(int supersedePolicy READ supersedePolicyInt WRITE setSupersedePolicyInt NOTIFY supersedePolicyChanged)
 
     QmlFutureWatcher();
     ~QmlFutureWatcher() override;
 
+    void classBegin() override { }
+    void componentComplete() override;
+
+public slots:
+    void pool();
+    void reuse();
+
 signals:
     void uninitialized();
     void initialized();
@@ -39,6 +67,13 @@ signals:
     void finished(bool isFulfilled, const QVariant& result, const QVariant& resultConverted);
     void fulfilled(const QVariant& result, const QVariant& resultConverted);
     void canceled();
+    // Results reported since previous batch, each result is delivered once. Coalesced per event loop pass,
+    // the last batch is delivered before finished(). Results are tracked only if this signal is connected.
+    void resultsReady(int startIndex, const QVariantList& results, const QVariantList& resultsConverted);
+
+protected:
+    void connectNotify(const QMetaMethod& signal) override;
+    void timerEvent(QTimerEvent* event) override;
 
 // --- Properties support ---
 public:
@@ -50,10 +85,26 @@ public:
     bool isFinished() const;
     bool isCanceled() const;
     bool isFulfilled() const;
+    QF::DeliveryMode deliveryMode() const;
+    int deliveryModeInt() const { return (int)deliveryMode(); }
+    int progress() const;
+    int progressMin() const;
+    int progressMax() const;
+    QString progressText() const;
+    qreal progressRate() const;
+    bool cancelWhenUnobserved() const;
+    QF::SupersedePolicy supersedePolicy() const;
+    int supersedePolicyInt() const { return (int)supersedePolicy(); }
 
 public slots:
     void setFuture(const QVariant& value);
     void setFutureImpl(const QVariant& value);
+    void setDeliveryMode(QF::DeliveryMode value);
+    void setDeliveryModeInt(int value) { setDeliveryMode((QF::DeliveryMode)value); }
+    void setProgressRate(qreal value);
+    void setCancelWhenUnobserved(bool value);
+    void setSupersedePolicy(QF::SupersedePolicy value);
+    void setSupersedePolicyInt(int value) { setSupersedePolicy((QF::SupersedePolicy)value); }
 
 signals:
     void futureChanged(const QVariant& future);
@@ -63,11 +114,39 @@ signals:
     void isFinishedChanged(bool isFinished);
     void isCanceledChanged(bool isCanceled);
     void isFulfilledChanged(bool isFulfilled);
+    void deliveryModeChanged(QF::DeliveryMode deliveryMode);
+    void progressChanged(int progress);
+    void progressMinChanged(int progressMin);
+    void progressMaxChanged(int progressMax);
+    void progressTextChanged(const QString& progressText);
+    void progressRateChanged(qreal progressRate);
+    void cancelWhenUnobservedChanged(bool cancelWhenUnobserved);
+    void supersedePolicyChanged(QF::SupersedePolicy supersedePolicy);
 // --- ---
 
+private slots:
+    void onCoalescedStateChanged();
+    void deliverResults();
+
 private:
+    void hookDelegatePool();
     static void registerTypes();
+    void connectWrapper();
+    void disconnectWrapper();
+    void cancelIfUnobserved();
+    void supersede(const QVariant& value);
+    void scheduleResults();
+    void onFutureProgressChanged();
+    void updateProgress();
     void onFutureStateChanged();
+    void scheduleCoalescedStateChanged();
+    void updateState();
+    void rebind(const QVariant& value);
+    void rebindState(bool futureReplaced);
+    void reportFulfilled();
+    void reportCanceled();
+    void setFlags(bool isFinished, bool isCanceled, bool isFulfilled);
+    void notifyChanges(bool wasFinished, bool wasCanceled, bool wasFulfilled, bool resultReplaced = false); // Emits only real changes
 
 private:
     QF_DECLARE_PIMPL
@@ -6,11 +6,17 @@
 #include <QObject>
 #include <QVariant>
 #include <QJSValue>
+#include <QJSValueList>
+#include <memory>
 #include <QmlFutures/Tools.h>
 #include <QmlFutures/QF.h>
+#include <QmlFutures/FutureId.h>
 
 namespace QmlFutures {
 
+class Condition;
+using ConditionPtr = std::shared_ptr<Condition>;
+
 //
 // Singleton. Exposed to QML.
 // Allows to handle QFuture<T> in QML.
@@ -21,15 +27,34 @@ class QmlFutures : public QObject, public Internal::Singleton<QmlFutures>
     Q_OBJECT
     friend class Init;
 public:
+    Q_PROPERTY(qreal dispatchBudget READ dispatchBudget WRITE setDispatchBudget NOTIFY dispatchBudgetChanged)
+    Q_PROPERTY(QObject* dispatchWindow READ dispatchWindow WRITE setDispatchWindow NOTIFY dispatchWindowChanged)
+    Q_PROPERTY(qreal progressRate READ progressRate WRITE setProgressRate NOTIFY progressRateChanged)
+
     QmlFutures();
     ~QmlFutures() override;
 
     Q_INVOKABLE bool isSupportedFuture(const QVariant& value);
 
-    Q_INVOKABLE void onFinished(const QVariant& future, const QVariant& context, const QJSValue& handler);
-    Q_INVOKABLE void onResult(const QVariant& future, const QVariant& context, const QJSValue& handler);
-    Q_INVOKABLE void onFulfilled(const QVariant& future, const QVariant& context, const QJSValue& handler);
-    Q_INVOKABLE void onCanceled(const QVariant& future, const QVariant& context, const QJSValue& handler);
+    // Return subscription handle for 'unsubscribe', 0 if handler was called (or dropped) right away.
+    // Handler of finished future queued by 'dispatchBudget' gets a handle too.
+    // 'cancelWhenUnobserved': future is canceled once all its observers are gone (context died, unsubscribed)
+    // before it's finished. Futures of QF.createFuture / QF.combine pass cancellation to their sources.
+    Q_INVOKABLE int onFinished(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal, bool cancelWhenUnobserved = false);
+    Q_INVOKABLE int onResult(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal, bool cancelWhenUnobserved = false);
+    Q_INVOKABLE int onFulfilled(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal, bool cancelWhenUnobserved = false);
+    Q_INVOKABLE int onCanceled(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal);
+    // Streaming: handler(future, startIndex, results, resultsConverted) gets results reported since previous batch.
+    // Batches are coalesced per event loop pass, the last one is delivered before 'finished' handlers.
+    Q_INVOKABLE int onResultsReady(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal);
+    // handler(future, value, minimum, maximum, text), at most 'progressRate' times per second (final one on completion)
+    Q_INVOKABLE int onProgress(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal);
+    Q_INVOKABLE bool unsubscribe(int handle);
+
+    // Bulk versions: one call per array of futures, return array of handles
+    Q_INVOKABLE QVariantList onEachFinished(const QVariantList& futures, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal, bool cancelWhenUnobserved = false);
+    Q_INVOKABLE QVariantList onEachFulfilled(const QVariantList& futures, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal, bool cancelWhenUnobserved = false);
+    Q_INVOKABLE QVariantList onEachCanceled(const QVariantList& futures, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority = QF::DispatchPriority::Normal);
     Q_INVOKABLE void forget(const QVariant& future);
     Q_INVOKABLE void wait(const QVariant& future);
 
@@ -42,10 +67,42 @@ public:
 
     Q_INVOKABLE QF::WatcherState stateOf(const QVariant& future);
 
+    // Bulk queries: array in, array of the same length out
+    Q_INVOKABLE QVariantList statesOf(const QVariantList& futures);
+    Q_INVOKABLE QVariantList resultsRawOf(const QVariantList& futures);
+    Q_INVOKABLE QVariantList resultsConvOf(const QVariantList& futures);
+
+    // Dispatch latency / frame time histograms, see Dispatcher::stats
+    Q_INVOKABLE QVariantMap dispatchStats() const;
+    Q_INVOKABLE void resetDispatchStats();
+
+// --- Properties support ---
+public:
+    qreal dispatchBudget() const;
+    void setDispatchBudget(qreal value);
+    QObject* dispatchWindow() const;
+    void setDispatchWindow(QObject* value);
+    qreal progressRate() const;
+    void setProgressRate(qreal value);
+
+signals:
+    void dispatchBudgetChanged(qreal dispatchBudget);
+    void dispatchWindowChanged(QObject* dispatchWindow);
+    void progressRateChanged(qreal progressRate);
+// --- ---
+
 private:
     struct Context;
     using ContextPtr = std::shared_ptr<Context>;
 
+    enum class HandlerKind {
+        Finished,
+        Fulfilled,
+        Canceled,
+        ResultsReady,
+        Progress
+    };
+
 private:
     static void registerTypes();
 
@@ -57,9 +114,25 @@ private:
     ContextPtr findFutureCtx(Context* ctx);
     ContextPtr findOrAppendFutureCtx(const QVariant& future, bool append = false);
     ContextPtr createFutureCtx(const QVariant& future);
+    void removeFutureCtx(Context* ctx);
+
+    int appendHandler(HandlerKind kind, const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority, bool cancelWhenUnobserved = false);
+    void dispatch(QF::DispatchPriority priority, const QJSValue& handler, const QJSValueList& args, const ConditionPtr& condition = {}, int subscription = 0);
+    int dispatchFinished(QF::DispatchPriority priority, const QJSValue& handler, const QJSValueList& args);
+    void removeHandler(int handlerId);
+    void linkCondition(Condition* condition, int handlerId);
+    void unlinkCondition(Condition* condition, int handlerId);
+
+    void scheduleResults(Context* ctx);
+    void flushResults();
+    void deliverResults(Context* ctx);
+
+    void progressChanged(Context* ctx);
+    void flushProgress();
+    void deliverProgress(Context* ctx);
 
     void futureChanged(Context* ctxPtr);
-    void conditionChanged();
+    void conditionChanged(Condition* condition);
 
 private:
     QF_DECLARE_PIMPL
@@ -7,6 +7,8 @@
 #include <QString>
 #include <utility>
 #include <memory>
+#include <vector>
+#include <optional>
 #include <cassert>
 
 //
@@ -73,5 +75,88 @@ private:
 template<class T>
 T* Singleton<T>::m_instance = nullptr;
 
+//
+// Generational slot map: O(1) insert / lookup / erase by stable handle.
+// Handle of erased item never matches again (generation is bumped on erase).
+//
+
+struct SlotHandle
+{
+    quint32 index { 0 };
+    quint32 generation { 0 };
+
+    bool isNull() const { return generation == 0; }
+};
+
+template<typename T>
+class SlotMap
+{
+public:
+    SlotHandle insert(T value) {
+        quint32 index;
+
+        if (m_free.empty()) {
+            index = static_cast<quint32>(m_slots.size());
+            m_slots.emplace_back();
+        } else {
+            index = m_free.back();
+            m_free.pop_back();
+        }
+
+        auto& slot = m_slots[index];
+        slot.value = std::move(value);
+        m_size++;
+        return {index, slot.generation};
+    }
+
+    // Returns default-constructed T for dangling handle
+    T value(SlotHandle handle) const {
+        return contains(handle) ? *m_slots[handle.index].value : T();
+    }
+
+    bool contains(SlotHandle handle) const {
+        return handle.index < m_slots.size() &&
+               m_slots[handle.index].generation == handle.generation &&
+               m_slots[handle.index].value.has_value();
+    }
+
+    bool erase(SlotHandle handle) {
+        if (!contains(handle))
+            return false;
+
+        auto& slot = m_slots[handle.index];
+
+        // Destroy after the map is consistent: destructor may re-enter it
+        T victim = std::move(*slot.value);
+        slot.value.reset();
+        if (!++slot.generation) slot.generation = 1;
+        m_free.push_back(handle.index);
+        m_size--;
+
+        return true;
+    }
+
+    template<typename Func>
+    void forEach(Func func) const {
+        for (const auto& x : m_slots)
+            if (x.value)
+                func(*x.value);
+    }
+
+    int size() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+
+private:
+    struct Slot
+    {
+        std::optional<T> value;
+        quint32 generation { 1 };
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<quint32> m_free;
+    int m_size { 0 };
+};
+
 } // namespace Internal
 } // namespace QmlFutures
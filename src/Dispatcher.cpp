@@ -0,0 +1,241 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <QmlFutures/Dispatcher.h>
+
+#include <QQuickWindow>
+#include <QPointer>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QHash>
+#include <array>
+#include <deque>
+
+namespace QmlFutures {
+
+namespace {
+
+// Power-of-two buckets, last one is unbounded
+constexpr std::array<qreal, 8> HistogramBounds { 0.5, 1, 2, 4, 8, 16, 32, 64 };
+
+struct Histogram
+{
+    std::array<quint64, HistogramBounds.size() + 1> counts {};
+
+    void add(qint64 nsecs) {
+        const qreal ms = qreal(nsecs) / 1000000;
+        size_t i = 0;
+
+        while (i < HistogramBounds.size() && ms > HistogramBounds[i])
+            i++;
+
+        counts[i]++;
+    }
+
+    QVariantList toList() const {
+        QVariantList result;
+        for (auto x : counts)
+            result.append(x);
+        return result;
+    }
+};
+
+} // namespace
+
+struct Dispatcher::impl_t
+{
+    struct Invocation
+    {
+        QJSValue handler;
+        QJSValueList args;
+        ConditionPtr condition;
+        qint64 enqueuedAt { 0 };
+        int subscription { 0 };
+    };
+
+    std::deque<Invocation>& queue(QF::DispatchPriority priority) {
+        return priority == QF::DispatchPriority::Idle ? idleQueue : normalQueue;
+    }
+
+    qreal budget { 0 };
+    QPointer<QQuickWindow> window;
+    QMetaObject::Connection windowConnection;
+    QTimer timer;
+    QElapsedTimer clock;
+    qint64 lastFrameAt { -1 };
+
+    std::deque<Invocation> normalQueue;
+    std::deque<Invocation> idleQueue;
+    QHash<int, int> pendingSubscriptions; // Subscription -> number of its queued invocations, removed on cancel
+
+    Histogram latency;
+    Histogram frameTime;
+};
+
+namespace {
+
+void invoke(const QJSValue& handler, const QJSValueList& args, const ConditionPtr& condition)
+{
+    // Condition could be switched off while invocation was queued
+    if (condition && (!condition->isActive() || !condition->isValid()))
+        return;
+
+    if (handler.isCallable())
+        QJSValue(handler).call(args);
+}
+
+} // namespace
+
+
+Dispatcher::Dispatcher()
+{
+    createImpl();
+    impl().clock.start();
+    impl().timer.setSingleShot(true);
+    QObject::connect(&impl().timer, &QTimer::timeout, this, [this](){ drain(false); });
+}
+
+Dispatcher::~Dispatcher()
+{
+}
+
+qreal Dispatcher::budget() const
+{
+    return impl().budget;
+}
+
+void Dispatcher::setBudget(qreal value)
+{
+    assert(value >= 0);
+    impl().budget = value;
+
+    // Disabled: nothing may stay queued
+    if (impl().budget <= 0)
+        drain(true);
+}
+
+QObject* Dispatcher::window() const
+{
+    return impl().window;
+}
+
+void Dispatcher::setWindow(QObject* value)
+{
+    auto window = qobject_cast<QQuickWindow*>(value);
+    assert(!value || window);
+
+    QObject::disconnect(impl().windowConnection);
+    impl().window = window;
+    impl().lastFrameAt = -1;
+
+    if (window)
+        impl().windowConnection = QObject::connect(window, &QQuickWindow::afterAnimating, this, &Dispatcher::onFrame);
+
+    if (pendingCount())
+        scheduleDrain();
+}
+
+bool Dispatcher::isQueued(QF::DispatchPriority priority) const
+{
+    return impl().budget > 0 && priority != QF::DispatchPriority::Immediate;
+}
+
+void Dispatcher::dispatch(QF::DispatchPriority priority, const QJSValue& handler, const QJSValueList& args, const ConditionPtr& condition, int subscription)
+{
+    if (!isQueued(priority)) {
+        invoke(handler, args, condition);
+        return;
+    }
+
+    impl().queue(priority).push_back({handler, args, condition, impl().clock.nsecsElapsed(), subscription});
+
+    if (subscription)
+        impl().pendingSubscriptions[subscription]++;
+
+    scheduleDrain();
+}
+
+bool Dispatcher::cancel(int subscription)
+{
+    // Invocation stays in queue and is skipped when reached
+    return subscription && impl().pendingSubscriptions.remove(subscription);
+}
+
+int Dispatcher::pendingCount() const
+{
+    return int(impl().normalQueue.size() + impl().idleQueue.size());
+}
+
+QVariantMap Dispatcher::stats() const
+{
+    QVariantList buckets;
+    for (auto x : HistogramBounds)
+        buckets.append(x);
+
+    QVariantMap result;
+    result["buckets"] = buckets;
+    result["latency"] = impl().latency.toList();
+    result["frameTime"] = impl().frameTime.toList();
+    result["pending"] = pendingCount();
+    return result;
+}
+
+void Dispatcher::resetStats()
+{
+    impl().latency = {};
+    impl().frameTime = {};
+}
+
+void Dispatcher::scheduleDrain()
+{
+    if (impl().window) {
+        impl().window->update();
+    } else if (!impl().timer.isActive()) {
+        impl().timer.start(0);
+    }
+}
+
+void Dispatcher::onFrame()
+{
+    const auto now = impl().clock.nsecsElapsed();
+
+    if (impl().lastFrameAt >= 0)
+        impl().frameTime.add(now - impl().lastFrameAt);
+
+    impl().lastFrameAt = now;
+
+    if (pendingCount())
+        drain(false);
+}
+
+void Dispatcher::drain(bool all)
+{
+    const auto deadline = impl().clock.nsecsElapsed() + qint64(impl().budget * 1000000);
+    bool progress = false; // At least one invocation per frame, even if budget is tiny
+
+    for (auto queue : {&impl().normalQueue, &impl().idleQueue}) {
+        while (!queue->empty() && (all || !progress || impl().clock.nsecsElapsed() < deadline)) {
+            auto invocation = std::move(queue->front());
+            queue->pop_front();
+            progress = true;
+
+            if (invocation.subscription) {
+                auto it = impl().pendingSubscriptions.find(invocation.subscription);
+                if (it == impl().pendingSubscriptions.end())
+                    continue; // Canceled
+
+                if (--it.value() == 0)
+                    impl().pendingSubscriptions.erase(it);
+            }
+
+            impl().latency.add(impl().clock.nsecsElapsed() - invocation.enqueuedAt);
+            invoke(invocation.handler, invocation.args, invocation.condition);
+        }
+    }
+
+    if (pendingCount())
+        scheduleDrain();
+}
+
+} // namespace QmlFutures
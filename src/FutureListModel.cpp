@@ -0,0 +1,287 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <QmlFutures/FutureListModel.h>
+
+#include <QQmlEngine>
+#include <QTimer>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <QmlFutures/Init.h>
+
+namespace QmlFutures {
+
+struct FutureListModel::impl_t
+{
+    struct Row
+    {
+        QVariant future;
+        std::shared_ptr<FutureWrapper> wrapper; // Shared with other observers of the same future
+        QMetaObject::Connection stateConnection;
+        QMetaObject::Connection progressConnection;
+        int index { 0 };
+        bool dirty { false };
+    };
+
+    void renumber(int from) {
+        for (int i = from; i < static_cast<int>(rows.size()); i++)
+            rows[static_cast<size_t>(i)]->index = i;
+    }
+
+    static void release(Row& row) {
+        QObject::disconnect(row.stateConnection);
+        QObject::disconnect(row.progressConnection);
+    }
+
+    std::vector<std::unique_ptr<Row>> rows; // Row is pinned: connections refer to it
+    std::vector<Row*> dirtyRows;
+    std::vector<int> dirtyIndexes; // Kept to not reallocate on each flush
+    QTimer timer;
+    int updateInterval { 0 };
+};
+
+FutureListModel::FutureListModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+    createImpl();
+    impl().timer.setSingleShot(true);
+    QObject::connect(&impl().timer, &QTimer::timeout, this, &FutureListModel::flush);
+}
+
+FutureListModel::~FutureListModel()
+{
+    for (auto& x : impl().rows)
+        impl_t::release(*x);
+}
+
+void FutureListModel::append(const QVariant& future)
+{
+    insertFutures(count(), {future});
+}
+
+void FutureListModel::appendAll(const QVariantList& futures)
+{
+    insertFutures(count(), futures);
+}
+
+void FutureListModel::insert(int row, const QVariant& future)
+{
+    insertFutures(row, {future});
+}
+
+void FutureListModel::remove(int row, int count)
+{
+    assert(row >= 0 && count >= 0 && row + count <= this->count());
+
+    if (!count)
+        return;
+
+    beginRemoveRows(QModelIndex(), row, row + count - 1);
+
+    const auto first = impl().rows.begin() + row;
+    const auto last = first + count;
+    bool anyDirty = false;
+
+    for (auto it = first; it != last; ++it) {
+        impl_t::release(**it);
+        anyDirty |= (*it)->dirty;
+    }
+
+    // One pass over pending updates, rows still have their indexes
+    if (anyDirty) {
+        auto& dirtyRows = impl().dirtyRows;
+        dirtyRows.erase(std::remove_if(dirtyRows.begin(), dirtyRows.end(), [row, count](const impl_t::Row* x){
+                            return x->index >= row && x->index < row + count;
+                        }),
+                        dirtyRows.end());
+    }
+
+    impl().rows.erase(first, last);
+    impl().renumber(row);
+
+    endRemoveRows();
+    emit countChanged(this->count());
+}
+
+void FutureListModel::clear()
+{
+    if (impl().rows.empty())
+        return;
+
+    beginResetModel();
+
+    for (auto& x : impl().rows)
+        impl_t::release(*x);
+
+    impl().rows.clear();
+    impl().dirtyRows.clear();
+    impl().timer.stop();
+
+    endResetModel();
+    emit countChanged(count());
+}
+
+QVariant FutureListModel::future(int row) const
+{
+    if (row < 0 || row >= count())
+        return {};
+
+    return impl().rows[static_cast<size_t>(row)]->future;
+}
+
+int FutureListModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : count();
+}
+
+QVariant FutureListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= count())
+        return {};
+
+    const auto& row = *impl().rows[static_cast<size_t>(index.row())];
+
+    switch (role) {
+        case FutureRole:
+            return row.future;
+
+        case StateRole:
+            return static_cast<int>(row.wrapper->getState());
+
+        case ResultRole:
+            return row.wrapper->getState() == QF::WatcherState::FinishedFulfilled ? row.wrapper->resultVariant() : QVariant();
+
+        case ResultConvertedRole:
+            return row.wrapper->getState() == QF::WatcherState::FinishedFulfilled ? row.wrapper->resultConverted() : QVariant();
+
+        case IsFinishedRole:
+            return row.wrapper->isFinished();
+
+        case ProgressRole:
+            return row.wrapper->progress();
+
+        default:
+            return {};
+    }
+}
+
+QHash<int, QByteArray> FutureListModel::roleNames() const
+{
+    static const QHash<int, QByteArray> names {
+        {FutureRole, "future"},
+        {StateRole, "state"},
+        {ResultRole, "result"},
+        {ResultConvertedRole, "resultConverted"},
+        {IsFinishedRole, "isFinished"},
+        {ProgressRole, "progress"}
+    };
+
+    return names;
+}
+
+int FutureListModel::count() const
+{
+    return static_cast<int>(impl().rows.size());
+}
+
+int FutureListModel::updateInterval() const
+{
+    return impl().updateInterval;
+}
+
+void FutureListModel::setUpdateInterval(int value)
+{
+    assert(value >= 0);
+
+    if (impl().updateInterval == value)
+        return;
+
+    impl().updateInterval = value;
+    emit updateIntervalChanged(impl().updateInterval);
+}
+
+void FutureListModel::registerTypes()
+{
+    qmlRegisterType<FutureListModel>("QmlFutures", 1, 0, "FutureListModel");
+}
+
+void FutureListModel::insertFutures(int row, const QVariantList& futures)
+{
+    assert(row >= 0 && row <= count());
+
+    if (futures.isEmpty())
+        return;
+
+    auto init = Init::instance();
+
+    beginInsertRows(QModelIndex(), row, row + static_cast<int>(futures.size()) - 1);
+
+    std::vector<std::unique_ptr<impl_t::Row>> newRows;
+    newRows.reserve(static_cast<size_t>(futures.size()));
+
+    for (const auto& future : futures) {
+        assert(init->isSupportedFuture(future) && "Unknown QVariant passed to FutureListModel!");
+
+        auto x = std::make_unique<impl_t::Row>();
+        auto rowPtr = x.get();
+        x->future = future;
+        x->wrapper = init->createFutureWrapper(future);
+
+        // No queued connection: changes of rows are gathered and flushed at once
+        auto markDirty = [this, rowPtr](){
+            if (rowPtr->dirty)
+                return;
+
+            rowPtr->dirty = true;
+            impl().dirtyRows.push_back(rowPtr);
+
+            if (!impl().timer.isActive())
+                impl().timer.start(impl().updateInterval);
+        };
+
+        x->stateConnection = QObject::connect(x->wrapper.get(), &FutureWrapper::stateChanged, this, markDirty);
+        x->progressConnection = QObject::connect(x->wrapper.get(), &FutureWrapper::progressChanged, this, markDirty);
+        newRows.push_back(std::move(x));
+    }
+
+    impl().rows.insert(impl().rows.begin() + row,
+                       std::make_move_iterator(newRows.begin()),
+                       std::make_move_iterator(newRows.end()));
+    impl().renumber(row);
+
+    endInsertRows();
+    emit countChanged(count());
+}
+
+void FutureListModel::flush()
+{
+    static const QVector<int> roles { StateRole, ResultRole, ResultConvertedRole, IsFinishedRole, ProgressRole };
+
+    auto& indexes = impl().dirtyIndexes;
+    indexes.clear();
+
+    for (auto x : impl().dirtyRows) {
+        x->dirty = false;
+        indexes.push_back(x->index);
+    }
+
+    impl().dirtyRows.clear();
+    std::sort(indexes.begin(), indexes.end());
+
+    // Contiguous rows are reported by one dataChanged
+    size_t i = 0;
+
+    while (i < indexes.size()) {
+        size_t j = i;
+
+        while (j + 1 < indexes.size() && indexes[j + 1] == indexes[j] + 1)
+            j++;
+
+        emit dataChanged(index(indexes[i]), index(indexes[j]), roles);
+        i = j + 1;
+    }
+}
+
+} // namespace QmlFutures
@@ -8,22 +8,64 @@
 
 namespace QmlFutures {
 
-QF::WatcherState FutureWrapper::getState() const
+QF::WatcherState Internal::watcherState(const QFutureInterfaceBase& interface)
 {
-    if (isFinished()) {
-        if (isCanceled()) {
-            return QF::WatcherState::FinishedCanceled;
-        } else {
-            return QF::WatcherState::FinishedFulfilled;
-        }
-    } else if (isPaused()) {
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    const int state = interface.loadState();
+    const int pausedMask = QFutureInterfaceBase::Suspending | QFutureInterfaceBase::Suspended;
+#else
+    // Qt5 doesn't expose the raw flags. Read them in the order they are reported:
+    // 'Canceled' is always set before 'Finished', so once 'Finished' is seen the rest is final.
+    int state = 0;
+    if (interface.queryState(QFutureInterfaceBase::Finished)) state |= QFutureInterfaceBase::Finished;
+    if (interface.queryState(QFutureInterfaceBase::Canceled)) state |= QFutureInterfaceBase::Canceled;
+    if (interface.queryState(QFutureInterfaceBase::Paused))   state |= QFutureInterfaceBase::Paused;
+    if (interface.queryState(QFutureInterfaceBase::Started))  state |= QFutureInterfaceBase::Started;
+    const int pausedMask = QFutureInterfaceBase::Paused;
+#endif
+
+    if (state & QFutureInterfaceBase::Finished) {
+        return (state & QFutureInterfaceBase::Canceled) ? QF::WatcherState::FinishedCanceled : QF::WatcherState::FinishedFulfilled;
+    } else if (state & pausedMask) {
+        return QF::WatcherState::Paused;
+    } else if (state & QFutureInterfaceBase::Started) {
+        return QF::WatcherState::Running;
+    } else {
+        return QF::WatcherState::Pending;
+    }
+}
+
+#if QT_VERSION < QT_VERSION_CHECK(6,0,0)
+QF::WatcherState Internal::watcherState(const QFuture<void>& future)
+{
+    // Same order as above: once 'Finished' is seen, 'Canceled' is final
+    if (future.isFinished()) {
+        return future.isCanceled() ? QF::WatcherState::FinishedCanceled : QF::WatcherState::FinishedFulfilled;
+    } else if (future.isPaused()) {
         return QF::WatcherState::Paused;
-    } else if (isStarted()) {
+    } else if (future.isStarted()) {
         return QF::WatcherState::Running;
     } else {
         return QF::WatcherState::Pending;
     }
 }
+#endif
+
+FutureWrapper::~FutureWrapper()
+{
+    emit released(m_id);
+}
+
+void FutureWrapper::observeResults()
+{
+    if (m_resultsObserved)
+        return;
+
+    m_resultsObserved = true;
+
+    if (auto watcher = getWatcher())
+        QObject::connect(watcher.get(), &QFutureWatcherBase::resultsReadyAt, this, &FutureWrapper::resultsReady);
+}
 
 void FutureWrapper::waitEL()
 {
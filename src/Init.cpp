@@ -5,12 +5,15 @@
 #include <QmlFutures/Init.h>
 
 #include <QObject>
-#include <QMap>
 #include <QQmlEngine>
+#include <QHash>
+#include <algorithm>
 #include <memory>
+#include <vector>
 #include <QmlFutures/QF.h>
 #include <QmlFutures/QmlFutures.h>
 #include <QmlFutures/QmlFutureWatcher.h>
+#include <QmlFutures/FutureListModel.h>
 #include <QmlFutures/Condition.h>
 #include <QmlFutures/QmlPromise.h>
 #include <QmlFutures/Qml.h>
@@ -36,11 +39,54 @@ namespace QmlFutures {
 
 struct Init::impl_t
 {
+    struct TypeEntry
+    {
+        const FutureOps* ops { nullptr };
+        std::shared_ptr<const void> converter;
+    };
+
+    // Dense table indexed by (typeId - QMetaType::User): all registered QFuture<T> are user types
+    static int indexOf(int typeId) { return typeId - static_cast<int>(QMetaType::User); }
+
+    const TypeEntry* find(int typeId) const {
+        const auto index = indexOf(typeId);
+        if (index < 0 || index >= static_cast<int>(futureTypes.size()))
+            return nullptr;
+
+        const auto& entry = futureTypes[static_cast<size_t>(index)];
+        return entry.ops ? &entry : nullptr;
+    }
+
+    const TypeEntry& get(int typeId) const {
+        auto entry = find(typeId);
+        assert(entry && "Have you registered this type?");
+        return *entry;
+    }
+
+    // Qt5 QFuture<void> has no identity: its wrapper is found by comparing futures (see FutureId)
+    std::shared_ptr<FutureWrapper> findAnonymous(const TypeEntry& entry, const QVariant& future) const {
+        for (const auto& x : anonymousWrappers) {
+            auto wrapper = x.lock();
+            if (wrapper && entry.ops->equals(wrapper->getFuture(), future))
+                return wrapper;
+        }
+
+        return {};
+    }
+
+    std::shared_ptr<FutureWrapper> findWrapper(const TypeEntry& entry, const QVariant& future) const {
+        const auto id = entry.ops->identity(future);
+        return id.isNull() ? findAnonymous(entry, future) : wrappers.value(id).lock();
+    }
+
     QObject context;
     QQmlEngine* engine { nullptr };
+    QHash<FutureId, std::weak_ptr<FutureWrapper>> wrappers; // Outlives singletons, they release wrappers
+    std::vector<std::weak_ptr<FutureWrapper>> anonymousWrappers; // Futures without identity, Qt5 QFuture<void>
+    QHash<FutureId, std::function<void()>> cancelHooks;     // Outlives singletons too
     QmlFutures qmlFuturesSingleton;
     QF qfSingleton;
-    QMap<int, FactoryMethod> futureWrappersFactory;
+    std::vector<TypeEntry> futureTypes;
 };
 
 Init::Init(QQmlEngine& qmlEngine)
@@ -52,6 +98,7 @@ Init::Init(QQmlEngine& qmlEngine)
 
     QF::registerTypes();
     QmlFutureWatcher::registerTypes();
+    FutureListModel::registerTypes();
     Condition::registerTypes();
     QmlCondition::registerTypes();
     Qml::init(qmlEngine);
@@ -81,15 +128,130 @@ QQmlEngine* Init::engine()
 
 std::shared_ptr<FutureWrapper> Init::createFutureWrapper(const QVariant& unknownFuture)
 {
-    auto typeId = unknownFuture.userType();
-    assert(impl().futureWrappersFactory.contains(typeId) && "Have you registered this type?");
-    auto wrapper = impl().futureWrappersFactory.value(typeId)(unknownFuture);
+    const auto& entry = impl().get(unknownFuture.userType());
+
+    if (auto wrapper = impl().findWrapper(entry, unknownFuture))
+        return wrapper;
+
+    const auto id = entry.ops->identity(unknownFuture);
+    auto wrapper = entry.ops->createWrapper(unknownFuture, entry.converter.get());
+
+    if (id.isNull()) {
+        impl().anonymousWrappers.push_back(wrapper);
+
+        QObject::connect(wrapper.get(), &FutureWrapper::released, &impl().context, [this](){
+            auto& anonymous = impl().anonymousWrappers;
+            anonymous.erase(std::remove_if(anonymous.begin(), anonymous.end(), [](const std::weak_ptr<FutureWrapper>& x){ return x.expired(); }),
+                            anonymous.end());
+        });
+
+        return wrapper;
+    }
+
+    impl().wrappers.insert(id, wrapper);
+
+    // Wrapper keeps its QFuture alive, so 'id' can't be reused until it's destroyed (or rebound)
+    QObject::connect(wrapper.get(), &FutureWrapper::released, &impl().context, [this](FutureId id){
+        auto it = impl().wrappers.find(id);
+        if (it != impl().wrappers.end() && it->expired())
+            impl().wrappers.erase(it);
+    });
+
     return wrapper;
 }
 
+bool Init::rebindFutureWrapper(std::shared_ptr<FutureWrapper>& wrapper, const QVariant& unknownFuture)
+{
+    const auto& entry = impl().get(unknownFuture.userType());
+
+    // Future is already observed (by this wrapper or somebody else): share its wrapper
+    if (auto existing = impl().findWrapper(entry, unknownFuture)) {
+        const bool same = (existing == wrapper);
+        wrapper = std::move(existing);
+        return same;
+    }
+
+    if (wrapper && wrapper.use_count() == 1) {
+        const auto previousId = wrapper->id();
+
+        // Only wrapper with identity is re-targeted, see FutureWrapperT<void>::rebind
+        if (wrapper->rebind(unknownFuture)) {
+            impl().wrappers.remove(previousId);
+            impl().wrappers.insert(wrapper->id(), wrapper);
+            return true;
+        }
+    }
+
+    wrapper = createFutureWrapper(unknownFuture);
+    return false;
+}
+
+bool Init::cancelIfUnobserved(const std::shared_ptr<FutureWrapper>& wrapper)
+{
+    if (!wrapper || wrapper.use_count() > 1 || wrapper->isFinished())
+        return false;
+
+    cancelFuture(wrapper);
+    return true;
+}
+
+void Init::cancelFuture(const std::shared_ptr<FutureWrapper>& wrapper)
+{
+    if (!wrapper || wrapper->isFinished())
+        return;
+
+    wrapper->cancel();
+
+    // Taken out first: hook cancels further futures and could modify the hash
+    const auto hook = impl().cancelHooks.take(wrapper->id());
+    if (hook)
+        hook();
+}
+
+void Init::setCancelHook(const FutureId& id, const std::function<void()>& hook)
+{
+    assert(hook);
+    impl().cancelHooks.insert(id, hook);
+}
+
+void Init::removeCancelHook(const FutureId& id)
+{
+    impl().cancelHooks.remove(id);
+}
+
 bool Init::isSupportedFuture(const QVariant& unknownFuture) const
 {
-    return impl().futureWrappersFactory.contains(unknownFuture.userType());
+    return impl().find(unknownFuture.userType());
+}
+
+FutureId Init::futureId(const QVariant& unknownFuture) const
+{
+    const auto& entry = impl().get(unknownFuture.userType());
+    const auto id = entry.ops->identity(unknownFuture);
+
+    if (!id.isNull())
+        return id;
+
+    // No identity of its own (Qt5 QFuture<void>): identity of its wrapper, null while it isn't observed
+    const auto wrapper = impl().findAnonymous(entry, unknownFuture);
+    return wrapper ? wrapper->id() : FutureId();
+}
+
+const FutureOps& Init::futureOps(const QVariant& unknownFuture) const
+{
+    return *impl().get(unknownFuture.userType()).ops;
+}
+
+QVariant Init::resultConverted(const QVariant& unknownFuture) const
+{
+    const auto& entry = impl().get(unknownFuture.userType());
+    return entry.ops->resultConverted(unknownFuture, entry.converter.get());
+}
+
+QVariantList Init::resultsConverted(const QVariant& unknownFuture, int begin, int end) const
+{
+    const auto& entry = impl().get(unknownFuture.userType());
+    return entry.ops->resultsConverted(unknownFuture, begin, end, entry.converter.get());
 }
 
 bool Init::isCondition(const QVariant& value)
@@ -102,11 +264,17 @@ bool Init::isNull(const QVariant& value)
     return (value.isNull() || !value.isValid());
 }
 
-void Init::registerType(int typeId, const FactoryMethod& converter)
+void Init::registerType(int typeId, const FutureOps* ops, const std::shared_ptr<const void>& converter)
 {
-    assert(!impl().futureWrappersFactory.contains(typeId) && "Already registered");
-    assert(converter);
-    impl().futureWrappersFactory.insert(typeId, converter);
+    assert(ops);
+    const auto index = impl_t::indexOf(typeId);
+    assert(index >= 0 && "QFuture<T> is expected to be a user type");
+    assert(!impl().find(typeId) && "Already registered");
+
+    if (index >= static_cast<int>(impl().futureTypes.size()))
+        impl().futureTypes.resize(static_cast<size_t>(index) + 1);
+
+    impl().futureTypes[static_cast<size_t>(index)] = {ops, converter};
 }
 
 } // namespace QmlFutures
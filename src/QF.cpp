@@ -7,10 +7,14 @@
 #include <QQmlEngine>
 #include <QMap>
 #include <QTimer>
+#include <QElapsedTimer>
 #include <QJSValueList>
 #include <QMetaEnum>
 #include <cassert>
 #include <optional>
+#include <vector>
+#include <algorithm>
+#include <functional>
 #include <QmlFutures/Init.h>
 #include <QmlFutures/Metatypes.h>
 #include <QmlFutures/Condition.h>
@@ -21,12 +25,48 @@ namespace QmlFutures {
 
 struct QF::CombineCtx
 {
+    // Future or condition, with its last observed contribution
+    struct Source
+    {
+        std::shared_ptr<FutureWrapper> future;
+        ConditionPtr condition;
+        bool isFulfilled { false };
+        bool isCanceled { false };
+        qreal weight { 1 };
+        qreal progress { 0 }; // [0..1], condition is either 0 or 1
+
+        bool isFinished() const { return isFulfilled || isCanceled; }
+
+        // Returns true if state changed
+        bool update() {
+            const bool fulfilled = future ? future->isFulfilled() : (condition->isActive() == condition->triggerOn());
+            const bool canceled  = future ? future->isCanceled()  : !condition->isValid();
+
+            if (fulfilled == isFulfilled && canceled == isCanceled)
+                return false;
+
+            isFulfilled = fulfilled;
+            isCanceled = canceled;
+            return true;
+        }
+    };
+
+    static constexpr int ContextIndex = -1;
+    static constexpr int ProgressMaximum = 1000;
+
     QF* master { nullptr };
-    std::shared_ptr<FutureWrapper> context;
+    Internal::SlotHandle handle;
     QF::CombineTrigger trigger;
     QFutureInterface<QVariant> interface;
-    QList<std::shared_ptr<FutureWrapper>> futureWrappers;
-    QList<ConditionPtr> conditions;
+    FutureId id { FutureId::of(interface.future()) };
+    std::optional<Source> context;
+    std::vector<Source> sources;
+    int fulfilledCount { 0 };
+    int canceledCount { 0 };
+    qreal totalWeight { 0 };
+    qreal weightedProgress { 0 }; // Sum of progress * weight, for 'All'
+    qreal maxProgress { 0 };      // Most advanced source, for 'Any'
+    bool progressPending { false };
     QList<QMetaObject::Connection> connections;
 
     CombineCtx(QF* master)
@@ -37,6 +77,7 @@ struct QF::CombineCtx
 
     ~CombineCtx() {
         disconnect();
+        Init::instance()->removeCancelHook(id);
 
         if (!interface.isFinished()) {
             interface.reportCanceled();
@@ -44,50 +85,84 @@ struct QF::CombineCtx
         }
     }
 
-    bool isCanceled() {
-        if (context && context->isFinished())
-            return true;
+    static Source makeSource(const QVariant& value) {
+        Source source;
+
+        if (QF::isFuture(value)) {
+            source.future = Init::instance()->createFutureWrapper(value);
+        } else {
+            assert(QF::isCondition(value));
+            source.condition = value.value<ConditionPtr>();
+        }
+
+        return source;
+    }
 
-        for (const auto& x : qAsConst(futureWrappers))
-            if (x->isCanceled())
-                return true;
+    // O(1): only the changed source is re-evaluated, counters are adjusted by delta
+    void update(int index) {
+        if (index == ContextIndex) {
+            context->update();
+            return;
+        }
+
+        auto& source = sources[index];
+        const bool wasFulfilled = source.isFulfilled;
+        const bool wasCanceled = source.isCanceled;
 
-        for (const auto& x : qAsConst(conditions))
-            if (!x->isValid())
-                return true;
+        if (!source.update())
+            return;
 
-        return false;
+        fulfilledCount += int(source.isFulfilled) - int(wasFulfilled);
+        canceledCount += int(source.isCanceled) - int(wasCanceled);
+        updateProgress(index);
     }
 
-    bool isFulfilled() {
-        switch (trigger) {
-            case QF::CombineTrigger::Any:
-                for (const auto& x : qAsConst(futureWrappers))
-                    if (x->isFulfilled())
-                        return true;
+    // Returns true if aggregate progress changed. O(1) unless the most advanced source goes back
+    bool updateProgress(int index) {
+        auto& source = sources[index];
+        const qreal value = source.future ? source.future->progress() : qreal(source.isFulfilled);
 
-                for (const auto& x : qAsConst(conditions))
-                    if (x->isActive() == x->triggerOn())
-                        return true;
+        if (value == source.progress)
+            return false;
 
-                return false;
-                break;
+        const qreal old = source.progress;
+        source.progress = value;
+        weightedProgress += (value - old) * source.weight;
+
+        if (value > maxProgress) {
+            maxProgress = value;
+        } else if (old == maxProgress) {
+            maxProgress = 0;
+
+            for (const auto& x : sources)
+                maxProgress = std::max(maxProgress, x.progress);
+        }
 
-            case QF::CombineTrigger::All: {
-                int counter = 0;
-                int limit = futureWrappers.size() + conditions.size();
+        return true;
+    }
+
+    int progressValue() const {
+        const qreal value = (trigger == QF::CombineTrigger::Any) ? maxProgress : weightedProgress / totalWeight;
+        return qBound(0, qRound(value * ProgressMaximum), ProgressMaximum);
+    }
 
-                for (const auto& x : qAsConst(futureWrappers))
-                    if (x->isFulfilled())
-                        counter++;
+    // QFutureInterface ignores decreasing values, so the reported progress never goes back
+    void reportProgress() {
+        progressPending = false;
+        interface.setProgressValue(progressValue());
+    }
 
-                for (const auto& x : qAsConst(conditions))
-                    if (x->isActive() == x->triggerOn())
-                        counter++;
+    bool isCanceled() const {
+        return (context && context->isFinished()) || canceledCount > 0;
+    }
 
-                return (counter == limit);
-                break;
-            }
+    bool isFulfilled() const {
+        switch (trigger) {
+            case QF::CombineTrigger::Any:
+                return fulfilledCount > 0;
+
+            case QF::CombineTrigger::All:
+                return fulfilledCount == int(sources.size());
         }
 
         assert(!"Unexpected flow");
@@ -95,21 +170,26 @@ struct QF::CombineCtx
     }
 
     void connect() {
-        if (context) {
-            auto con = QObject::connect(context.get(), &FutureWrapper::stateChanged, master, [this, master = master](){ master->recheckCombineCtx(this); });
-            connections.append(con);
-        }
+        if (context)
+            connect(*context, ContextIndex);
 
-        for (const auto& x : qAsConst(futureWrappers)) {
-            auto con = QObject::connect(x.get(), &FutureWrapper::stateChanged, master, [this, master = master](){ master->recheckCombineCtx(this); });
-            connections.append(con);
-        }
+        for (int i = 0; i < int(sources.size()); i++)
+            connect(sources[i], i);
+    }
+
+    void connect(const Source& source, int index) {
+        auto recheck = [handle = handle, master = master, index](){ master->recheckCombineCtx(handle, index); };
 
-        for (const auto& x : qAsConst(conditions)) {
-            auto con1 = QObject::connect(x.get(), &Condition::isActiveChanged, master, [this, master = master](){ master->recheckCombineCtx(this); });
-            auto con2 = QObject::connect(x.get(), &Condition::isValidChanged, master, [this, master = master](){ master->recheckCombineCtx(this); });
-            connections.append(con1);
-            connections.append(con2);
+        if (source.future) {
+            connections.append(QObject::connect(source.future.get(), &FutureWrapper::stateChanged, master, recheck));
+
+            if (index != ContextIndex) {
+                auto progress = [handle = handle, master = master, index](){ master->recheckCombineProgress(handle, index); };
+                connections.append(QObject::connect(source.future.get(), &FutureWrapper::progressChanged, master, progress));
+            }
+        } else {
+            connections.append(QObject::connect(source.condition.get(), &Condition::isActiveChanged, master, recheck));
+            connections.append(QObject::connect(source.condition.get(), &Condition::isValidChanged, master, recheck));
         }
     }
 
@@ -133,11 +213,13 @@ struct QF::FutureCtx
 
     ~FutureCtx() {
         disconnect();
+        Init::instance()->removeCancelHook(id);
     }
 
     QF* master;
 
     QFutureInterface<QVariant> interface;
+    FutureId id { FutureId::of(interface.future()) };
 
     ConditionPtr condition;
     ConditionPtr conditionCancel;
@@ -145,42 +227,71 @@ struct QF::FutureCtx
     std::shared_ptr<FutureWrapper> futureWrapper;
     std::shared_ptr<FutureWrapper> futureCancelWrapper;
 
+    // Conditions and wrappers are shared with other contexts, so only own connections are dropped
+    QList<QMetaObject::Connection> connections;
+
     void disconnect() {
-        if (condition) QObject::disconnect(condition.get(), nullptr, master, nullptr);
-        if (conditionCancel) QObject::disconnect(conditionCancel.get(), nullptr, master, nullptr);
+        for (auto& x : connections) {
+            QObject::disconnect(x);
+        }
+
+        connections.clear();
     }
 };
 
+// Entry of the min-heap driven by single shared QTimer
 struct QF::TimedFutureCtx
 {
+    qint64 deadline { 0 };
+    quint64 sequence { 0 };
     QFutureInterface<QVariant> interface;
-    QTimer timer;
     std::optional<QVariant> value;
+
+    // Earlier deadline first, FIFO for equal deadlines
+    bool operator>(const TimedFutureCtx& other) const {
+        return (deadline != other.deadline) ? (deadline > other.deadline) : (sequence > other.sequence);
+    }
 };
 
 struct QF::impl_t
 {
-    QList<FutureCtxPtr> futures;
-    QList<TimedFutureCtxPtr> timedFutures;
-    QList<CombineCtxPtr> combines;
+    Internal::SlotMap<FutureCtxPtr> futures;
+    Internal::SlotMap<CombineCtxPtr> combines;
+
+    std::vector<TimedFutureCtx> timedFutures; // Min-heap by deadline
+    QTimer timedFuturesTimer;
+    QElapsedTimer clock;
+    quint64 timedFuturesSequence { 0 };
+
+    // Combined progress throttling: first change is reported at once and starts combineProgressTimer,
+    // following ones are gathered and reported once per tick
+    std::vector<Internal::SlotHandle> pendingCombineProgress;
+    QTimer combineProgressTimer;
 };
 
+// Slower than QFutureInterface's own limit (25/s), so trailing value isn't dropped by it
+static constexpr int CombineProgressInterval = 50;
+
 
 QF::QF()
 {
     createImpl();
+    impl().clock.start();
+    impl().timedFuturesTimer.setSingleShot(true);
+    QObject::connect(&impl().timedFuturesTimer, &QTimer::timeout, this, &QF::finishTimedFutures);
+    QObject::connect(&impl().combineProgressTimer, &QTimer::timeout, this, &QF::flushCombineProgress);
 }
 
 QF::~QF()
 {
-    for (const auto& x : qAsConst(impl().futures)) {
+    impl().futures.forEach([](const FutureCtxPtr& x){
         x->interface.reportCanceled();
         x->interface.reportFinished();
-    }
+    });
 
-    for (const auto& x : qAsConst(impl().timedFutures)) {
-        x->interface.reportCanceled();
-        x->interface.reportFinished();
+    for (auto& x : impl().timedFutures) {
+        x.interface.reportCanceled();
+        x.interface.reportFinished();
     }
 }
 
@@ -210,6 +321,13 @@ QVariant QF::createFuture(const QVariant& fulfilTrigger, const QVariant& cancelT
     assert(!isValid2 || isCondition2 || isFuture2);
 
     FutureCtxPtr ctx = std::make_shared<FutureCtx>(this);
+    const auto handle = impl().futures.insert(ctx);
+
+    // Already finished, no need to keep context
+    auto finished = [this, handle, &ctx]() {
+        impl().futures.erase(handle);
+        return QVariant::fromValue(ctx->interface.future());
+    };
 
     // Handle 'fulfil' trigger
     if (isCondition1) {
@@ -220,11 +338,11 @@ QVariant QF::createFuture(const QVariant& fulfilTrigger, const QVariant& cancelT
         if (ctx->condition->isActive() == ctx->condition->triggerOn()) {
             ctx->interface.reportResult(QVariant::fromValue(nullptr));
             ctx->interface.reportFinished();
-            return QVariant::fromValue(ctx->interface.future());
+            return finished();
 
         } else {
-            QObject::connect(ctx->condition.get(), &Condition::isActiveChanged, this, [this, ptr = ctx.get()](){ recheckFulfilCond(ptr); });
-            QObject::connect(ctx->condition.get(), &Condition::isValidChanged, this, [this, ptr = ctx.get()](){ recheckFulfilCond(ptr); });
+            ctx->connections.append(QObject::connect(ctx->condition.get(), &Condition::isActiveChanged, this, [this, handle](){ recheckFulfilCond(handle); }));
+            ctx->connections.append(QObject::connect(ctx->condition.get(), &Condition::isValidChanged, this, [this, handle](){ recheckFulfilCond(handle); }));
         }
 
     } else if (isFuture1) {
@@ -241,10 +359,10 @@ QVariant QF::createFuture(const QVariant& fulfilTrigger, const QVariant& cancelT
             }
 
             ctx->interface.reportFinished();
-            return QVariant::fromValue(ctx->interface.future());
+            return finished();
 
         } else {
-            QObject::connect(ctx->futureWrapper.get(), &FutureWrapper::stateChanged, this, [this, ptr = ctx.get()](){ recheckFutureCond(ptr); });
+            ctx->connections.append(QObject::connect(ctx->futureWrapper.get(), &FutureWrapper::stateChanged, this, [this, handle](){ recheckFutureCond(handle); }));
         }
 
     } else {
@@ -259,11 +377,11 @@ QVariant QF::createFuture(const QVariant& fulfilTrigger, const QVariant& cancelT
         if (ctx->conditionCancel->isActive() == ctx->conditionCancel->triggerOn()) {
             ctx->interface.reportCanceled();
             ctx->interface.reportFinished();
-            return QVariant::fromValue(ctx->interface.future());
+            return finished();
 
         } else {
-            QObject::connect(ctx->conditionCancel.get(), &Condition::isActiveChanged, this, [this, ptr = ctx.get()](){ recheckCancelCond(ptr); });
-            QObject::connect(ctx->conditionCancel.get(), &Condition::isValidChanged, this, [this, ptr = ctx.get()](){ recheckCancelCond(ptr); });
+            ctx->connections.append(QObject::connect(ctx->conditionCancel.get(), &Condition::isActiveChanged, this, [this, handle](){ recheckCancelCond(handle); }));
+            ctx->connections.append(QObject::connect(ctx->conditionCancel.get(), &Condition::isValidChanged, this, [this, handle](){ recheckCancelCond(handle); }));
         }
 
     } else if (isFuture2) {
@@ -272,17 +390,18 @@ QVariant QF::createFuture(const QVariant& fulfilTrigger, const QVariant& cancelT
         if (ctx->futureCancelWrapper->isFinished()) {
             ctx->interface.reportCanceled();
             ctx->interface.reportFinished();
-            return QVariant::fromValue(ctx->interface.future());
+            return finished();
 
         } else {
-            QObject::connect(ctx->futureCancelWrapper.get(), &FutureWrapper::stateChanged, this, [this, ptr = ctx.get()](){ recheckFutureCancelCond(ptr); });
+            ctx->connections.append(QObject::connect(ctx->futureCancelWrapper.get(), &FutureWrapper::stateChanged, this, [this, handle](){ recheckFutureCancelCond(handle); }));
         }
 
     } else {
         // Nothing.
     }
 
-    impl().futures.append(ctx);
+    // Canceled by its last observer: fulfil trigger isn't needed anymore
+    Init::instance()->setCancelHook(ctx->id, [this, handle](){ cancelFutureCtx(handle); });
     return QVariant::fromValue(ctx->interface.future());
 }
 
@@ -291,17 +410,14 @@ QVariant QF::createTimedFuture(const QVariant& result, int time)
     assert(time >= 0);
 
     if (time) {
-        auto ctx = std::make_shared<TimedFutureCtx>();
-        ctx->interface.reportStarted();
-        ctx->value = result;
-
-        ctx->timer.setSingleShot(true);
-        QObject::connect(&ctx->timer, &QTimer::timeout, this, [this, ctx = ctx.get()](){ finishTimedFuture(ctx); }, Qt::QueuedConnection);
-        impl().timedFutures.append(ctx);
-
-        ctx->timer.start(time);
+        TimedFutureCtx ctx;
+        ctx.deadline = impl().clock.elapsed() + time;
+        ctx.interface.reportStarted();
+        ctx.value = result;
 
-        return QVariant::fromValue(ctx->interface.future());
+        auto future = ctx.interface.future();
+        scheduleTimedFuture(std::move(ctx));
+        return QVariant::fromValue(future);
 
     } else {
         QFutureInterface<QVariant> interface;
@@ -317,16 +433,13 @@ QVariant QF::createTimedCanceledFuture(int time)
     assert(time >= 0);
 
     if (time) {
-        auto ctx = std::make_shared<TimedFutureCtx>();
-        ctx->interface.reportStarted();
-
-        ctx->timer.setSingleShot(true);
-        QObject::connect(&ctx->timer, &QTimer::timeout, this, [this, ctx = ctx.get()](){ finishTimedFuture(ctx); }, Qt::QueuedConnection);
-        impl().timedFutures.append(ctx);
-
-        ctx->timer.start(time);
+        TimedFutureCtx ctx;
+        ctx.deadline = impl().clock.elapsed() + time;
+        ctx.interface.reportStarted();
 
-        return QVariant::fromValue(ctx->interface.future());
+        auto future = ctx.interface.future();
+        scheduleTimedFuture(std::move(ctx));
+        return QVariant::fromValue(future);
 
     } else {
         QFutureInterface<QVariant> interface;
@@ -337,7 +450,7 @@ QVariant QF::createTimedCanceledFuture(int time)
     }
 }
 
-QVariant QF::combine(CombineTrigger trigger, const QVariant& context, const QVariant& sources)
+QVariant QF::combine(CombineTrigger trigger, const QVariant& context, const QVariant& sources, const QVariantList& weights)
 {
     assert(Internal::isValidEnumValue(trigger));
 
@@ -352,48 +465,63 @@ QVariant QF::combine(CombineTrigger trigger, const QVariant& context, const QVar
         return createTimedFuture(QVariant(), 0);
 
     } else if (isFuture(sources)) {
-        return combine(trigger, context, QVariantList{sources});
+        return combine(trigger, context, QVariantList{sources}, weights);
 
     } else if (isCondition(sources)) {
-        return combine(trigger, context, QVariantList{sources});
+        return combine(trigger, context, QVariantList{sources}, weights);
     }
 
     auto list = sources.toList();
     assert(!list.isEmpty());
+    assert((weights.isEmpty() || weights.size() == list.size()) && "Weights should be set for each source!");
+
+    bool anyFulfilled = false;
 
-    for (const auto& x : list)
+    for (const auto& x : qAsConst(list)) {
         assert(isFuture(x) || isCondition(x));
 
-    for (const auto& x : list)
         if (isCanceled(x))
             return createTimedCanceledFuture(0);
 
-    for (const auto& x : list)
-        if (isFulfilled(x))
-            return createTimedFuture(QVariant(), 0);
+        anyFulfilled = anyFulfilled || isFulfilled(x);
+    }
+
+    if (anyFulfilled)
+        return createTimedFuture(QVariant(), 0);
 
     auto ctx = std::make_shared<CombineCtx>(this);
     ctx->trigger = trigger;
+    ctx->sources.reserve(list.size());
 
-    if (!isNull(context)) {
-        // Convert context
-        auto contextFutureVar = combine(QF::CombineTrigger::Any, QVariant(), context);
-        auto contextFuture = Init::instance()->createFutureWrapper(contextFutureVar);
-        ctx->context = contextFuture;
-    }
+    if (!isNull(context))
+        ctx->context = CombineCtx::makeSource(context);
 
-    for (const auto& x : list) {
-        if (isFuture(x)) {
-            ctx->futureWrappers.append(Init::instance()->createFutureWrapper(x));
+    for (int i = 0; i < int(list.size()); i++) {
+        ctx->sources.push_back(CombineCtx::makeSource(list[i]));
 
-        } else {
-            assert(isCondition(x));
-            ctx->conditions.append(x.value<ConditionPtr>());
+        if (!weights.isEmpty()) {
+            ctx->sources.back().weight = weights[i].toReal();
+            assert(ctx->sources.back().weight >= 0);
         }
+
+        ctx->totalWeight += ctx->sources.back().weight;
     }
 
+    assert(ctx->totalWeight > 0 && "At least one source should have non-zero weight!");
+
+    // Progress reported by sources before combining
+    ctx->interface.setProgressRange(0, CombineCtx::ProgressMaximum);
+
+    for (int i = 0; i < int(ctx->sources.size()); i++)
+        ctx->updateProgress(i);
+
+    ctx->reportProgress();
+
+    ctx->handle = impl().combines.insert(ctx);
     ctx->connect();
-    impl().combines.append(ctx);
+
+    // Canceled by its last observer: sources aren't needed anymore (context is not canceled, it's a guard)
+    Init::instance()->setCancelHook(ctx->id, [this, handle = ctx->handle](){ cancelCombineCtx(handle); });
     return QVariant::fromValue(ctx->interface.future());
 }
 
@@ -402,6 +530,9 @@ void QF::registerTypes()
     qRegisterMetaType<QF::WatcherState>("QF::WatcherState");
     qRegisterMetaType<QF::Comparison>("QF::Comparison");
     qRegisterMetaType<QF::CombineTrigger>("QF::CombineTrigger");
+    qRegisterMetaType<QF::DispatchPriority>("QF::DispatchPriority");
+    qRegisterMetaType<QF::DeliveryMode>("QF::DeliveryMode");
+    qRegisterMetaType<QF::SupersedePolicy>("QF::SupersedePolicy");
 
     qmlRegisterSingletonType<QF>("QmlFutures", 1, 0, "QF", [] (QQmlEngine *engine, QJSEngine *) -> QObject* {
         auto ret = QF::instance();
@@ -432,7 +563,7 @@ bool QF::isCanceled(const QVariant& value)
         return !condition->isValid();
 
     } else if (isFuture(value)) {
-        return Init::instance()->createFutureWrapper(value)->isCanceled();
+        return Init::instance()->futureOps(value).isCanceled(value);
 
     } else {
         assert(!"Unexpected value");
@@ -447,7 +578,8 @@ bool QF::isFulfilled(const QVariant& value)
         return (condition->isActive() == condition->triggerOn());
 
     } else if (isFuture(value)) {
-        return Init::instance()->createFutureWrapper(value)->isFulfilled();
+        const auto& ops = Init::instance()->futureOps(value);
+        return ops.isFinished(value) && !ops.isCanceled(value);
 
     } else {
         assert(!"Unexpected value");
@@ -455,133 +587,218 @@ bool QF::isFulfilled(const QVariant& value)
     }
 }
 
-void QF::recheckFulfilCond(FutureCtx* obj)
+void QF::recheckFulfilCond(Internal::SlotHandle handle)
 {
-    auto it = std::find_if(impl().futures.begin(), impl().futures.end(),
-                           [obj](const FutureCtxPtr& item) -> bool
-    {
-        return (item.get() == obj);
-    });
-
-    assert(it != impl().futures.end());
-
-    if (it->get()->condition->isActive() == it->get()->condition->triggerOn()) {
-        it->get()->disconnect();
-        it->get()->interface.reportResult(QVariant::fromValue(nullptr));
-        it->get()->interface.reportFinished();
-        impl().futures.erase(it);
+    auto ctx = impl().futures.value(handle);
+    if (!ctx)
+        return;
+
+    if (ctx->condition->isActive() == ctx->condition->triggerOn()) {
+        ctx->disconnect();
+        ctx->interface.reportResult(QVariant::fromValue(nullptr));
+        ctx->interface.reportFinished();
+        impl().futures.erase(handle);
+
+    } else if (!ctx->condition->isValid()) {
+        ctx->disconnect();
+        ctx->interface.reportCanceled();
+        ctx->interface.reportFinished();
+        impl().futures.erase(handle);
+    }
+}
 
-    } else if (!it->get()->condition->isValid()) {
-        it->get()->disconnect();
-        it->get()->interface.reportCanceled();
-        it->get()->interface.reportFinished();
-        impl().futures.erase(it);
+void QF::recheckCancelCond(Internal::SlotHandle handle)
+{
+    auto ctx = impl().futures.value(handle);
+    if (!ctx)
+        return;
+
+    if ((ctx->condition && !ctx->condition->isValid()) || ctx->conditionCancel->isActive() == ctx->conditionCancel->triggerOn()) {
+        ctx->disconnect();
+        ctx->interface.reportCanceled();
+        ctx->interface.reportFinished();
+        impl().futures.erase(handle);
     }
 }
 
-void QF::recheckCancelCond(FutureCtx* obj)
+void QF::scheduleTimedFuture(TimedFutureCtx&& ctx)
 {
-    auto it = std::find_if(impl().futures.begin(), impl().futures.end(),
-                           [obj](const FutureCtxPtr& item) -> bool
-    {
-        return (item.get() == obj);
-    });
+    auto& heap = impl().timedFutures;
 
-    assert(it != impl().futures.end());
+    const auto sequence = impl().timedFuturesSequence++;
+    ctx.sequence = sequence;
+    heap.push_back(std::move(ctx));
+    std::push_heap(heap.begin(), heap.end(), std::greater<>());
 
-    if (!it->get()->condition->isValid() || it->get()->conditionCancel->isActive() == it->get()->conditionCancel->triggerOn()) {
-        it->get()->disconnect();
-        it->get()->interface.reportCanceled();
-        it->get()->interface.reportFinished();
-        impl().futures.erase(it);
+    // Re-arm only if new entry became the earliest one
+    if (heap.front().sequence == sequence || !impl().timedFuturesTimer.isActive()) {
+        const auto delay = std::max<qint64>(heap.front().deadline - impl().clock.elapsed(), 0);
+        impl().timedFuturesTimer.start(int(delay));
     }
 }
 
-void QF::finishTimedFuture(TimedFutureCtx* ctx)
+void QF::finishTimedFutures()
 {
-    auto it = std::find_if(impl().timedFutures.begin(), impl().timedFutures.end(),
-                           [ctx](const TimedFutureCtxPtr& item) -> bool
-    {
-        return (item.get() == ctx);
-    });
+    auto& heap = impl().timedFutures;
+    const auto now = impl().clock.elapsed();
 
-    assert(it != impl().timedFutures.end());
+    // Extract whole batch first: reporting may schedule new timed futures
+    std::vector<TimedFutureCtx> batch;
 
-    if (it->get()->value) {
-        it->get()->interface.reportResult(*it->get()->value);
-    } else {
-        it->get()->interface.reportCanceled();
+    while (!heap.empty() && heap.front().deadline <= now) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+        batch.push_back(std::move(heap.back()));
+        heap.pop_back();
     }
 
-    it->get()->interface.reportFinished();
+    for (auto& x : batch) {
+        if (x.value) {
+            x.interface.reportResult(*x.value);
+        } else {
+            x.interface.reportCanceled();
+        }
+
+        x.interface.reportFinished();
+    }
 
-    impl().timedFutures.erase(it);
+    if (!heap.empty() && !impl().timedFuturesTimer.isActive()) {
+        const auto delay = std::max<qint64>(heap.front().deadline - impl().clock.elapsed(), 0);
+        impl().timedFuturesTimer.start(int(delay));
+    }
 }
 
-void QF::recheckFutureCond(FutureCtx* obj)
+void QF::recheckFutureCond(Internal::SlotHandle handle)
 {
-    auto it = std::find_if(impl().futures.begin(), impl().futures.end(),
-                           [obj](const FutureCtxPtr& item) -> bool
-    {
-        return (item.get() == obj);
-    });
+    auto ctx = impl().futures.value(handle);
+    if (!ctx)
+        return;
 
-    assert(it != impl().futures.end());
-
-    if (obj->futureWrapper->isStarted() &&
-        !obj->interface.isStarted())
+    if (ctx->futureWrapper->isStarted() &&
+        !ctx->interface.isStarted())
     {
-        obj->interface.reportStarted();
+        ctx->interface.reportStarted();
     }
 
-    if (obj->futureWrapper->isFinished()) {
-        if (obj->futureWrapper->isCanceled()) {
-            obj->interface.reportCanceled();
+    if (ctx->futureWrapper->isFinished()) {
+        if (ctx->futureWrapper->isCanceled()) {
+            ctx->interface.reportCanceled();
         } else {
-            obj->interface.reportResult(obj->futureWrapper->resultVariant());
+            ctx->interface.reportResult(ctx->futureWrapper->resultVariant());
         }
 
-        obj->interface.reportFinished();
+        ctx->interface.reportFinished();
 
-        impl().futures.erase(it);
+        impl().futures.erase(handle);
     }
 }
 
-void QF::recheckFutureCancelCond(FutureCtx* obj)
+void QF::recheckFutureCancelCond(Internal::SlotHandle handle)
 {
-    auto it = std::find_if(impl().futures.begin(), impl().futures.end(),
-                           [obj](const FutureCtxPtr& item) -> bool
-    {
-        return (item.get() == obj);
-    });
-
-    assert(it != impl().futures.end());
+    auto ctx = impl().futures.value(handle);
+    if (!ctx)
+        return;
+
+    if (ctx->futureCancelWrapper->isFinished()) {
+        ctx->interface.reportCanceled();
+        ctx->interface.reportFinished();
+        impl().futures.erase(handle);
+    }
+}
 
-    if (obj->futureCancelWrapper->isFinished()) {
-        obj->interface.reportCanceled();
-        obj->interface.reportFinished();
-        impl().futures.erase(it);
+void QF::recheckCombineCtx(Internal::SlotHandle handle, int sourceIndex)
+{
+    auto ctx = impl().combines.value(handle);
+    if (!ctx)
+        return;
+
+    const int progress = ctx->progressValue();
+    ctx->update(sourceIndex);
+
+    if (ctx->isCanceled()) {
+        ctx->interface.reportCanceled();
+        ctx->interface.reportFinished();
+        impl().combines.erase(handle);
+
+    } else if (ctx->isFulfilled()) {
+        ctx->interface.setProgressValue(CombineCtx::ProgressMaximum);
+        ctx->interface.reportResult(QVariant::fromValue(nullptr));
+        ctx->interface.reportFinished();
+        impl().combines.erase(handle);
+
+    } else if (ctx->progressValue() != progress) {
+        scheduleCombineProgress(*ctx);
     }
 }
 
-void QF::recheckCombineCtx(CombineCtx* ctx)
+void QF::cancelFutureCtx(Internal::SlotHandle handle)
 {
-    auto it = std::find_if(impl().combines.begin(), impl().combines.end(), [ctx](const CombineCtxPtr& item) -> bool {
-        return (item.get() == ctx);
-    });
+    auto ctx = impl().futures.value(handle);
+    if (!ctx)
+        return;
+
+    ctx->interface.reportCanceled();
+    ctx->interface.reportFinished();
+    impl().futures.erase(handle);
+
+    ctx->disconnect();
+    Init::instance()->cancelIfUnobserved(ctx->futureWrapper);
+}
+
+void QF::cancelCombineCtx(Internal::SlotHandle handle)
+{
+    auto ctx = impl().combines.value(handle);
+    if (!ctx)
+        return;
+
+    ctx->interface.reportCanceled();
+    ctx->interface.reportFinished();
+    impl().combines.erase(handle);
+
+    ctx->disconnect();
+
+    for (const auto& x : ctx->sources)
+        Init::instance()->cancelIfUnobserved(x.future);
+}
+
+void QF::recheckCombineProgress(Internal::SlotHandle handle, int sourceIndex)
+{
+    auto ctx = impl().combines.value(handle);
+    if (!ctx)
+        return;
+
+    if (ctx->updateProgress(sourceIndex))
+        scheduleCombineProgress(*ctx);
+}
+
+void QF::scheduleCombineProgress(CombineCtx& ctx)
+{
+    if (ctx.progressPending)
+        return;
 
-    assert(it != impl().combines.end());
+    if (impl().combineProgressTimer.isActive()) {
+        ctx.progressPending = true;
+        impl().pendingCombineProgress.push_back(ctx.handle);
+        return;
+    }
 
-    if (it->get()->isCanceled()) {
-        it->get()->interface.reportCanceled();
-        it->get()->interface.reportFinished();
-        impl().combines.erase(it);
+    ctx.reportProgress();
+    impl().combineProgressTimer.start(CombineProgressInterval);
+}
 
-    } else if (it->get()->isFulfilled()) {
-        it->get()->interface.reportResult(QVariant::fromValue(nullptr));
-        it->get()->interface.reportFinished();
-        impl().combines.erase(it);
+void QF::flushCombineProgress()
+{
+    // Nothing changed during last interval
+    if (impl().pendingCombineProgress.empty()) {
+        impl().combineProgressTimer.stop();
+        return;
     }
+
+    const auto pending = std::move(impl().pendingCombineProgress);
+    impl().pendingCombineProgress.clear();
+
+    for (const auto& handle : pending)
+        if (auto ctx = impl().combines.value(handle))
+            ctx->reportProgress();
 }
 
 } // namespace QmlFutures
@@ -5,6 +5,11 @@
 #include <QmlFutures/QmlFutureWatcher.h>
 
 #include <QQmlEngine>
+#include <QQuickItem>
+#include <QMetaMethod>
+#include <QBasicTimer>
+#include <QTimerEvent>
+#include <optional>
 #include <QmlFutures/Init.h>
 
 namespace QmlFutures {
@@ -14,11 +19,36 @@ struct QmlFutureWatcher::impl_t
     std::shared_ptr<FutureWrapper> wrapper;
     QVariant future;
     QF::WatcherState state { QF::WatcherState::Uninitialized };
-    QVariant result;
-    QVariant resultConverted;
     bool isFinished { false };
     bool isCanceled { false };
     bool isFulfilled { false };
+    QF::DeliveryMode deliveryMode { QF::DeliveryMode::Queued };
+    bool coalescedPending { false };
+    QMetaObject::Connection connection;
+
+    // Results streaming
+    QMetaObject::Connection resultsConnection;
+    bool streamResults { false };
+    bool resultsPending { false };
+    int deliveredResults { 0 };
+
+    // Progress, throttled to 'progressRate' updates per second
+    QMetaObject::Connection progressConnection;
+    Internal::ProgressInfo progress;
+    qreal progressRate { 30 };
+    QBasicTimer progressTimer;
+    bool progressPending { false };
+
+    bool cancelWhenUnobserved { false };
+    QF::SupersedePolicy supersedePolicy { QF::SupersedePolicy::Keep };
+
+    // Delegate pool support
+    bool pooled { false };
+    std::optional<QVariant> pooledFuture; // Set while pooled, applied by reuse()
+
+    // Materialized on first read, only for fulfilled future
+    mutable std::optional<QVariant> result;
+    mutable std::optional<QVariant> resultConverted;
 };
 
 QmlFutureWatcher::QmlFutureWatcher()
@@ -28,6 +58,9 @@ QmlFutureWatcher::QmlFutureWatcher()
 
 QmlFutureWatcher::~QmlFutureWatcher()
 {
+    // Watcher could outlive Init, e.g. if it's destroyed by QQmlEngine
+    if (impl().wrapper && Init::exists())
+        cancelIfUnobserved();
 }
 
 QVariant QmlFutureWatcher::future() const
@@ -42,12 +75,24 @@ QF::WatcherState QmlFutureWatcher::state() const
 
 QVariant QmlFutureWatcher::result() const
 {
-    return impl().result;
+    if (!impl().isFulfilled)
+        return {};
+
+    if (!impl().result)
+        impl().result = impl().wrapper->resultVariant();
+
+    return *impl().result;
 }
 
 QVariant QmlFutureWatcher::resultConverted() const
 {
-    return impl().resultConverted;
+    if (!impl().isFulfilled)
+        return {};
+
+    if (!impl().resultConverted)
+        impl().resultConverted = impl().wrapper->resultConverted();
+
+    return *impl().resultConverted;
 }
 
 bool QmlFutureWatcher::isFinished() const
@@ -65,14 +110,129 @@ bool QmlFutureWatcher::isFulfilled() const
     return impl().isFulfilled;
 }
 
+QF::DeliveryMode QmlFutureWatcher::deliveryMode() const
+{
+    return impl().deliveryMode;
+}
+
+int QmlFutureWatcher::progress() const
+{
+    return impl().progress.value;
+}
+
+int QmlFutureWatcher::progressMin() const
+{
+    return impl().progress.minimum;
+}
+
+int QmlFutureWatcher::progressMax() const
+{
+    return impl().progress.maximum;
+}
+
+QString QmlFutureWatcher::progressText() const
+{
+    return impl().progress.text;
+}
+
+qreal QmlFutureWatcher::progressRate() const
+{
+    return impl().progressRate;
+}
+
+bool QmlFutureWatcher::cancelWhenUnobserved() const
+{
+    return impl().cancelWhenUnobserved;
+}
+
+QF::SupersedePolicy QmlFutureWatcher::supersedePolicy() const
+{
+    return impl().supersedePolicy;
+}
+
+void QmlFutureWatcher::componentComplete()
+{
+    // View parents delegate to its contentItem and attaches its object before delegate is completed
+    hookDelegatePool();
+}
+
+void QmlFutureWatcher::pool()
+{
+    // Wrapper and connection to it are kept for reuse(), notifications are ignored meanwhile
+    impl().pooled = true;
+}
+
+void QmlFutureWatcher::reuse()
+{
+    if (!impl().pooled)
+        return;
+
+    impl().pooled = false;
+    const auto value = impl().pooledFuture.value_or(impl().future);
+    impl().pooledFuture.reset();
+
+    // Nothing to re-target: regular path
+    if (!impl().wrapper || Init::isNull(value)) {
+        setFuture(value);
+        return;
+    }
+
+    rebind(value);
+}
+
+void QmlFutureWatcher::rebind(const QVariant& value)
+{
+    assert(impl().wrapper && !Init::isNull(value));
+    assert(Init::instance()->isSupportedFuture(value) && "Unknown QVariant set to 'future' property!");
+
+    const auto previousId = impl().wrapper->id();
+
+    // Old future is left only if it isn't the new one (typed or not)
+    if (!previousId.sharesState(Init::instance()->futureId(value))) {
+        supersede(value);
+        cancelIfUnobserved();
+    }
+
+    if (!Init::instance()->rebindFutureWrapper(impl().wrapper, value)) {
+        disconnectWrapper();
+        connectWrapper();
+    }
+
+    impl().future = value;
+
+    if (impl().wrapper->id() != previousId)
+        impl().deliveredResults = 0;
+
+    rebindState(impl().wrapper->id() != previousId);
+
+    if (impl().streamResults)
+        scheduleResults();
+}
+
 void QmlFutureWatcher::setFuture(const QVariant& value)
 {
+    if (impl().pooled) {
+        impl().pooledFuture = value;
+        return;
+    }
+
     if (impl().future == value)
         return;
 
+    // Qt6 QFuture has no operator==, so copies of the same future compare unequal as QVariant:
+    // compare shared states before anything is torn down (and canceled as unobserved)
+    if (impl().wrapper && Init::instance()->isSupportedFuture(value) && Init::instance()->futureId(value) == impl().wrapper->id())
+        return;
+
     if (impl().state == QF::WatcherState::Uninitialized && (value.isNull() || !value.isValid()))
         return;
 
+    // Another future: single transition, no uninitialized() / initialized() in between
+    if (impl().wrapper && !Init::isNull(value)) {
+        rebind(value);
+        return;
+    }
+
     if (impl().state != QF::WatcherState::Uninitialized)
         setFutureImpl(QVariant());
 
@@ -81,33 +241,46 @@ void QmlFutureWatcher::setFuture(const QVariant& value)
 
 void QmlFutureWatcher::setFutureImpl(const QVariant& value)
 {
+    const bool wasFinished = impl().isFinished;
+    const bool wasCanceled = impl().isCanceled;
+    const bool wasFulfilled = impl().isFulfilled;
+
     if (value.isNull() || !value.isValid()) {
+        // Wrapper is shared with other observers of the same future
+        if (impl().wrapper) {
+            disconnectWrapper();
+            cancelIfUnobserved();
+        }
+
+        const bool hadState = (impl().state != QF::WatcherState::Uninitialized);
+        const bool hadFuture = !impl().future.isNull() && impl().future.isValid();
+
+        setFlags(false, false, false);
         impl().wrapper.reset();
+        impl().deliveredResults = 0;
+        updateProgress();
         impl().state = QF::WatcherState::Uninitialized;
         impl().future = QVariant();
-        impl().result = QVariant();
-        impl().resultConverted = QVariant();
-        impl().isFinished = false;
-        impl().isCanceled = false;
-        impl().isFulfilled = false;
 
-        emit stateChanged(impl().state);
-        emit futureChanged(impl().future);
-        emit resultChanged(impl().result);
-        emit resultConvertedChanged(impl().resultConverted);
-        emit isFinishedChanged(impl().isFinished);
-        emit isCanceledChanged(impl().isCanceled);
-        emit isFulfilledChanged(impl().isFulfilled);
+        if (hadState)
+            emit stateChanged(impl().state);
+
+        if (hadFuture)
+            emit futureChanged(impl().future);
+
+        notifyChanges(wasFinished, wasCanceled, wasFulfilled);
         emit uninitialized();
     } else {
         if (Init::instance()->isSupportedFuture(value)) {
             impl().future = value;
             impl().wrapper = Init::instance()->createFutureWrapper(value);
             impl().state = impl().wrapper->getState();
-            impl().result = QVariant();
-            impl().resultConverted = QVariant();
 
-            QObject::connect(impl().wrapper.get(), &FutureWrapper::stateChanged, this, &QmlFutureWatcher::onFutureStateChanged, Qt::QueuedConnection);
+            connectWrapper();
+            updateProgress();
+
+            if (impl().streamResults)
+                scheduleResults();
 
             emit initialized();
 
@@ -127,31 +300,11 @@ void QmlFutureWatcher::setFutureImpl(const QVariant& value)
                     break;
 
                 case QF::WatcherState::FinishedFulfilled:
-                    impl().result = impl().wrapper->resultVariant();
-                    impl().resultConverted = impl().wrapper->resultConverted();
-                    impl().isFinished = true;
-                    impl().isFulfilled = true;
-
-                    impl().state = QF::WatcherState::Finished;
-                    emit stateChanged(impl().state);
-                    emit finished(true, impl().result, impl().resultConverted);
-
-                    impl().state = QF::WatcherState::FinishedFulfilled;
-                    emit stateChanged(impl().state);
-                    emit fulfilled(impl().result, impl().resultConverted);
+                    reportFulfilled();
                     break;
 
                 case QF::WatcherState::FinishedCanceled:
-                    impl().isFinished = true;
-                    impl().isCanceled = true;
-
-                    impl().state = QF::WatcherState::Finished;
-                    emit stateChanged(impl().state);
-                    emit finished(false, QVariant(), QVariant());
-
-                    impl().state = QF::WatcherState::FinishedCanceled;
-                    emit stateChanged(impl().state);
-                    emit canceled();
+                    reportCanceled();
                     break;
 
                 case QF::WatcherState::Uninitialized:
@@ -161,11 +314,7 @@ void QmlFutureWatcher::setFutureImpl(const QVariant& value)
             }
 
             emit futureChanged(impl().future);
-            emit resultChanged(impl().result);
-            emit resultConvertedChanged(impl().resultConverted);
-            emit isFinishedChanged(impl().isFinished);
-            emit isCanceledChanged(impl().isCanceled);
-            emit isFulfilledChanged(impl().isFulfilled);
+            notifyChanges(wasFinished, wasCanceled, wasFulfilled);
 
         } else {
             // Unsupported QVariant. Is not QFuture<T>? QFuture<T> is not registered?
@@ -174,17 +323,297 @@ void QmlFutureWatcher::setFutureImpl(const QVariant& value)
     }
 }
 
+void QmlFutureWatcher::setDeliveryMode(QF::DeliveryMode value)
+{
+    assert(Internal::isValidEnumValue(value));
+
+    if (impl().deliveryMode == value)
+        return;
+
+    impl().deliveryMode = value;
+
+    if (impl().wrapper) {
+        disconnectWrapper();
+        connectWrapper();
+        updateState(); // Change could be lost in between
+    }
+
+    emit deliveryModeChanged(impl().deliveryMode);
+}
+
+void QmlFutureWatcher::setProgressRate(qreal value)
+{
+    assert(value >= 0);
+
+    if (impl().progressRate == value)
+        return;
+
+    impl().progressRate = value;
+
+    // New rate is applied on next change
+    if (impl().progressTimer.isActive()) {
+        impl().progressTimer.stop();
+        updateProgress();
+    }
+
+    emit progressRateChanged(impl().progressRate);
+}
+
+void QmlFutureWatcher::setCancelWhenUnobserved(bool value)
+{
+    if (impl().cancelWhenUnobserved == value)
+        return;
+
+    impl().cancelWhenUnobserved = value;
+    emit cancelWhenUnobservedChanged(impl().cancelWhenUnobserved);
+}
+
+void QmlFutureWatcher::setSupersedePolicy(QF::SupersedePolicy value)
+{
+    assert(Internal::isValidEnumValue(value));
+
+    if (impl().supersedePolicy == value)
+        return;
+
+    impl().supersedePolicy = value;
+    emit supersedePolicyChanged(impl().supersedePolicy);
+}
+
 void QmlFutureWatcher::registerTypes()
 {
     qmlRegisterType<QmlFutureWatcher>("QmlFutures", 1, 0, "QmlFutureWatcher");
 }
 
+void QmlFutureWatcher::connectNotify(const QMetaMethod& signal)
+{
+    static const auto resultsReadySignal = QMetaMethod::fromSignal(&QmlFutureWatcher::resultsReady);
+
+    if (signal != resultsReadySignal || impl().streamResults)
+        return;
+
+    impl().streamResults = true;
+
+    // Results could be reported before
+    if (impl().wrapper) {
+        disconnectWrapper();
+        connectWrapper();
+        scheduleResults();
+    }
+}
+
+void QmlFutureWatcher::connectWrapper()
+{
+    auto wrapper = impl().wrapper.get();
+    assert(wrapper);
+
+    if (impl().streamResults) {
+        wrapper->observeResults();
+        impl().resultsConnection = QObject::connect(wrapper, &FutureWrapper::resultsReady, this, &QmlFutureWatcher::scheduleResults);
+    }
+
+    impl().progressConnection = QObject::connect(wrapper, &FutureWrapper::progressChanged, this, &QmlFutureWatcher::onFutureProgressChanged);
+
+    switch (impl().deliveryMode) {
+        case QF::DeliveryMode::Queued:
+            impl().connection = QObject::connect(wrapper, &FutureWrapper::stateChanged, this, &QmlFutureWatcher::onFutureStateChanged, Qt::QueuedConnection);
+            break;
+
+        case QF::DeliveryMode::Direct:
+            impl().connection = QObject::connect(wrapper, &FutureWrapper::stateChanged, this, &QmlFutureWatcher::onFutureStateChanged, Qt::DirectConnection);
+            break;
+
+        case QF::DeliveryMode::Coalesced:
+            impl().connection = QObject::connect(wrapper, &FutureWrapper::stateChanged, this, &QmlFutureWatcher::scheduleCoalescedStateChanged, Qt::DirectConnection);
+            break;
+    }
+}
+
+void QmlFutureWatcher::disconnectWrapper()
+{
+    QObject::disconnect(impl().connection);
+    QObject::disconnect(impl().resultsConnection);
+    QObject::disconnect(impl().progressConnection);
+}
+
+void QmlFutureWatcher::cancelIfUnobserved()
+{
+    if (impl().cancelWhenUnobserved)
+        Init::instance()->cancelIfUnobserved(impl().wrapper);
+}
+
+void QmlFutureWatcher::supersede(const QVariant& value)
+{
+    // Reset to null isn't superseding, it's up to 'cancelWhenUnobserved'
+    if (impl().supersedePolicy != QF::SupersedePolicy::Cancel || !impl().wrapper || Init::isNull(value))
+        return;
+
+    // Same future again (no QFuture::operator== on Qt6, so it can't be caught by QVariant comparison),
+    // or the same one converted to QFuture<void>
+    if (Init::instance()->isSupportedFuture(value) && Init::instance()->futureId(value).sharesState(impl().wrapper->id()))
+        return;
+
+    Init::instance()->cancelFuture(impl().wrapper);
+}
+
 void QmlFutureWatcher::onFutureStateChanged()
 {
-    if (impl().state == impl().wrapper->getState())
+    // Queued notification from the wrapper which was already dropped
+    if (!impl().wrapper || sender() != impl().wrapper.get())
         return;
 
-    impl().state = impl().wrapper->getState();
+    updateState();
+}
+
+void QmlFutureWatcher::scheduleCoalescedStateChanged()
+{
+    if (impl().coalescedPending)
+        return;
+
+    impl().coalescedPending = true;
+    QMetaObject::invokeMethod(this, "onCoalescedStateChanged", Qt::QueuedConnection);
+}
+
+void QmlFutureWatcher::onCoalescedStateChanged()
+{
+    impl().coalescedPending = false;
+
+    // Current state is taken, so intermediate ones (e.g. 'Running' before 'Finished') are skipped
+    if (impl().wrapper)
+        updateState();
+}
+
+void QmlFutureWatcher::hookDelegatePool()
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5,14,0)
+    // Nearest item this watcher belongs to
+    auto object = parent();
+    while (object && !qobject_cast<QQuickItem*>(object))
+        object = object->parent();
+
+    // Delegate's root is parented to view's contentItem
+    for (auto item = static_cast<QQuickItem*>(object); item; item = item->parentItem()) {
+        const auto contentItem = item->parentItem();
+        const auto view = contentItem ? contentItem->parentItem() : nullptr;
+
+        if (!view || (!view->inherits("QQuickItemView") && !view->inherits("QQuickTableView")))
+            continue;
+
+        if (view->property("contentItem").value<QQuickItem*>() != contentItem)
+            continue;
+
+        // ListView.pooled / TableView.pooled. View may not have created attached object yet, the same one
+        // is created here. View may be a QML type derived from ListView, attached type belongs to C++ base.
+        QQmlAttachedPropertiesFunc attachedFunction = nullptr;
+        for (auto metaObject = view->metaObject(); metaObject && !attachedFunction; metaObject = metaObject->superClass())
+            attachedFunction = qmlAttachedPropertiesFunction(item, metaObject);
+
+        const auto attached = attachedFunction ? qmlAttachedPropertiesObject(item, attachedFunction, true) : nullptr;
+
+        if (attached && attached->metaObject()->indexOfSignal("pooled()") >= 0) {
+            QObject::connect(attached, SIGNAL(pooled()), this, SLOT(pool()));
+            QObject::connect(attached, SIGNAL(reused()), this, SLOT(reuse()));
+        }
+
+        return;
+    }
+#endif
+}
+
+void QmlFutureWatcher::scheduleResults()
+{
+    if (impl().resultsPending)
+        return;
+
+    impl().resultsPending = true;
+    QMetaObject::invokeMethod(this, "deliverResults", Qt::QueuedConnection);
+}
+
+void QmlFutureWatcher::deliverResults()
+{
+    impl().resultsPending = false;
+
+    if (!impl().streamResults || !impl().wrapper || impl().pooled)
+        return;
+
+    // Only results which weren't delivered yet are read
+    const auto begin = impl().deliveredResults;
+    const auto end = impl().wrapper->resultCount();
+
+    if (end <= begin)
+        return;
+
+    impl().deliveredResults = end;
+    emit resultsReady(begin, impl().wrapper->resultsVariant(begin, end), impl().wrapper->resultsConverted(begin, end));
+}
+
+void QmlFutureWatcher::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != impl().progressTimer.timerId()) {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    // Trailing update of the throttling interval, timer runs while changes keep coming
+    if (impl().progressPending) {
+        updateProgress();
+        impl().progressTimer.start(int(1000 / impl().progressRate), this);
+    } else {
+        impl().progressTimer.stop();
+    }
+}
+
+void QmlFutureWatcher::onFutureProgressChanged()
+{
+    if (impl().pooled)
+        return;
+
+    if (impl().progressTimer.isActive()) {
+        impl().progressPending = true;
+        return;
+    }
+
+    updateProgress();
+
+    if (impl().progressRate > 0)
+        impl().progressTimer.start(int(1000 / impl().progressRate), this);
+}
+
+void QmlFutureWatcher::updateProgress()
+{
+    impl().progressPending = false;
+
+    const auto previous = impl().progress;
+    impl().progress = impl().wrapper ? impl().wrapper->progressInfo() : Internal::ProgressInfo();
+
+    if (impl().progress.value != previous.value)
+        emit progressChanged(impl().progress.value);
+
+    if (impl().progress.minimum != previous.minimum)
+        emit progressMinChanged(impl().progress.minimum);
+
+    if (impl().progress.maximum != previous.maximum)
+        emit progressMaxChanged(impl().progress.maximum);
+
+    if (impl().progress.text != previous.text)
+        emit progressTextChanged(impl().progress.text);
+}
+
+void QmlFutureWatcher::updateState()
+{
+    // Dormant in delegate pool, state is re-read by reuse()
+    if (impl().pooled)
+        return;
+
+    const auto state = impl().wrapper->getState();
+
+    if (impl().state == state)
+        return;
+
+    impl().state = state;
+
+    const bool wasFinished = impl().isFinished;
+    const bool wasCanceled = impl().isCanceled;
+    const bool wasFulfilled = impl().isFulfilled;
 
     switch (impl().state) {
         case QF::WatcherState::Running:
@@ -198,40 +627,11 @@ void QmlFutureWatcher::onFutureStateChanged()
             break;
 
         case QF::WatcherState::FinishedFulfilled:
-            impl().result = impl().wrapper->resultVariant();
-            impl().resultConverted = impl().wrapper->resultConverted();
-            impl().isFinished = true;
-            impl().isFulfilled = true;
-
-            impl().state = QF::WatcherState::Finished;
-            emit stateChanged(impl().state);
-            emit finished(true, impl().result, impl().resultConverted);
-
-            impl().state = QF::WatcherState::FinishedFulfilled;
-            emit stateChanged(impl().state);
-            emit fulfilled(impl().result, impl().resultConverted);
-
-            emit resultChanged(impl().result);
-            emit resultConvertedChanged(impl().resultConverted);
-
-            emit isFinishedChanged(impl().isFinished);
-            emit isFulfilledChanged(impl().isFulfilled);
+            reportFulfilled();
             break;
 
         case QF::WatcherState::FinishedCanceled:
-            impl().isFinished = true;
-            impl().isCanceled = true;
-
-            impl().state = QF::WatcherState::Finished;
-            emit stateChanged(impl().state);
-            emit finished(false, QVariant(), QVariant());
-
-            impl().state = QF::WatcherState::FinishedCanceled;
-            emit stateChanged(impl().state);
-            emit canceled();
-
-            emit isFinishedChanged(impl().isFinished);
-            emit isCanceledChanged(impl().isCanceled);
+            reportCanceled();
             break;
 
         case QF::WatcherState::Pending:
@@ -240,6 +640,143 @@ void QmlFutureWatcher::onFutureStateChanged()
             assert(!"Unexpected state");
             break;
     }
+
+    notifyChanges(wasFinished, wasCanceled, wasFulfilled);
+}
+
+void QmlFutureWatcher::rebindState(bool futureReplaced)
+{
+    static const auto finishedSignal = QMetaMethod::fromSignal(&QmlFutureWatcher::finished);
+    static const auto fulfilledSignal = QMetaMethod::fromSignal(&QmlFutureWatcher::fulfilled);
+
+    const bool wasFinished = impl().isFinished;
+    const bool wasCanceled = impl().isCanceled;
+    const bool wasFulfilled = impl().isFulfilled;
+    const auto previousState = impl().state;
+
+    impl().state = impl().wrapper->getState();
+    const bool isFulfilled = (impl().state == QF::WatcherState::FinishedFulfilled);
+    const bool isCanceled = (impl().state == QF::WatcherState::FinishedCanceled);
+    setFlags(isFulfilled || isCanceled, isCanceled, isFulfilled);
+
+    if (futureReplaced)
+        emit futureChanged(impl().future);
+
+    if (previousState != impl().state)
+        emit stateChanged(impl().state);
+
+    // One transition: intermediate 'Finished' state isn't reported
+    if (isFulfilled || isCanceled)
+        deliverResults();
+
+    updateProgress();
+
+    if (futureReplaced || previousState != impl().state) {
+        switch (impl().state) {
+            case QF::WatcherState::Running:
+                emit started();
+                break;
+
+            case QF::WatcherState::Paused:
+                emit paused();
+                break;
+
+            case QF::WatcherState::FinishedFulfilled: {
+                const bool needResult = isSignalConnected(finishedSignal) || isSignalConnected(fulfilledSignal);
+                const auto result = needResult ? this->result() : QVariant();
+                const auto resultConverted = needResult ? this->resultConverted() : QVariant();
+                emit finished(true, result, resultConverted);
+                emit fulfilled(result, resultConverted);
+                break;
+            }
+
+            case QF::WatcherState::FinishedCanceled:
+                emit finished(false, QVariant(), QVariant());
+                emit canceled();
+                break;
+
+            case QF::WatcherState::Pending:
+                break;
+
+            case QF::WatcherState::Uninitialized:
+            case QF::WatcherState::Finished:
+                assert(!"Unexpected state");
+                break;
+        }
+    }
+
+    notifyChanges(wasFinished, wasCanceled, wasFulfilled, futureReplaced);
+}
+
+void QmlFutureWatcher::reportFulfilled()
+{
+    static const auto finishedSignal = QMetaMethod::fromSignal(&QmlFutureWatcher::finished);
+    static const auto fulfilledSignal = QMetaMethod::fromSignal(&QmlFutureWatcher::fulfilled);
+
+    deliverResults();
+    updateProgress();
+    setFlags(true, false, true);
+
+    // Result is passed only if somebody listens
+    const bool needResult = isSignalConnected(finishedSignal) || isSignalConnected(fulfilledSignal);
+    const auto result = needResult ? this->result() : QVariant();
+    const auto resultConverted = needResult ? this->resultConverted() : QVariant();
+
+    impl().state = QF::WatcherState::Finished;
+    emit stateChanged(impl().state);
+    emit finished(true, result, resultConverted);
+
+    impl().state = QF::WatcherState::FinishedFulfilled;
+    emit stateChanged(impl().state);
+    emit fulfilled(result, resultConverted);
+}
+
+void QmlFutureWatcher::reportCanceled()
+{
+    deliverResults();
+    updateProgress();
+    setFlags(true, true, false);
+
+    impl().state = QF::WatcherState::Finished;
+    emit stateChanged(impl().state);
+    emit finished(false, QVariant(), QVariant());
+
+    impl().state = QF::WatcherState::FinishedCanceled;
+    emit stateChanged(impl().state);
+    emit canceled();
+}
+
+void QmlFutureWatcher::setFlags(bool isFinished, bool isCanceled, bool isFulfilled)
+{
+    impl().isFinished = isFinished;
+    impl().isCanceled = isCanceled;
+    impl().isFulfilled = isFulfilled;
+    impl().result.reset();
+    impl().resultConverted.reset();
+}
+
+void QmlFutureWatcher::notifyChanges(bool wasFinished, bool wasCanceled, bool wasFulfilled, bool resultReplaced)
+{
+    static const auto resultSignal = QMetaMethod::fromSignal(&QmlFutureWatcher::resultChanged);
+    static const auto resultConvertedSignal = QMetaMethod::fromSignal(&QmlFutureWatcher::resultConvertedChanged);
+
+    // Result changes together with 'isFulfilled' (or with the future), it's not materialized if nobody is bound to it
+    if (wasFulfilled != impl().isFulfilled || (resultReplaced && impl().isFulfilled)) {
+        if (isSignalConnected(resultSignal))
+            emit resultChanged(result());
+
+        if (isSignalConnected(resultConvertedSignal))
+            emit resultConvertedChanged(resultConverted());
+    }
+
+    if (wasFinished != impl().isFinished)
+        emit isFinishedChanged(impl().isFinished);
+
+    if (wasCanceled != impl().isCanceled)
+        emit isCanceledChanged(impl().isCanceled);
+
+    if (wasFulfilled != impl().isFulfilled)
+        emit isFulfilledChanged(impl().isFulfilled);
 }
 
 } // namespace QmlFutures
@@ -6,63 +6,157 @@
 
 #include <QQmlEngine>
 #include <QList>
+#include <QHash>
+#include <QSet>
 #include <QJSValueList>
+#include <QTimer>
+#include <list>
+#include <optional>
 #include <QmlFutures/Init.h>
 #include <QmlFutures/Condition.h>
 #include <QmlFutures/FutureWrapper.h>
+#include <QmlFutures/Dispatcher.h>
 
 namespace QmlFutures {
 
+namespace {
+
+template<typename... Args>
+QJSValueList jsArgs(const Args&... args) {
+    auto engine = Init::instance()->engine();
+    return { engine->toScriptValue(args)... };
+}
+
+// Single pass over array of futures, results are packed to array of the same length
+template<typename Func>
+QVariantList mapFutures(const QVariantList& futures, Func func) {
+    QVariantList result;
+    result.reserve(futures.size());
+
+    for (const auto& x : futures)
+        result.append(QVariant(func(x)));
+
+    return result;
+}
+
+} // namespace
+
 struct HandlerCtx
 {
+    int id { 0 }; // Subscription handle
     ConditionPtr condition;
     QJSValue handler;
+    QF::DispatchPriority priority { QF::DispatchPriority::Normal };
 };
 
+using HandlerList = std::list<HandlerCtx>;
+
 struct QmlFutures::Context
 {
+    FutureId id;
     QVariant future;
-    std::shared_ptr<FutureWrapper> wrapper;
+    std::shared_ptr<FutureWrapper> wrapper; // Shared with other observers of the same future
+    QMetaObject::Connection connection;
+    QMetaObject::Connection resultsConnection; // Only if somebody streams results
+    int deliveredResults { 0 };
+    bool resultsScheduled { false };
+    QMetaObject::Connection progressConnection; // Only if somebody tracks progress
+    Internal::ProgressInfo deliveredProgress;
+    bool progressPending { false };
+    bool cancelWhenUnobserved { false }; // Set by any handler, sticks until context is removed
+
+    HandlerList finishedHandlers;
+    HandlerList resultHandlers;
+    HandlerList canceledHandlers;
+    HandlerList resultsReadyHandlers;
+    HandlerList progressHandlers;
+
+    HandlerList& handlers(HandlerKind kind) {
+        switch (kind) {
+            case HandlerKind::Finished:  return finishedHandlers;
+            case HandlerKind::Fulfilled: return resultHandlers;
+            case HandlerKind::Canceled:  return canceledHandlers;
+            case HandlerKind::ResultsReady: return resultsReadyHandlers;
+            case HandlerKind::Progress:  return progressHandlers;
+        }
 
-    QList<HandlerCtx> finishedHandlers;
-    QList<HandlerCtx> resultHandlers;
-    QList<HandlerCtx> canceledHandlers;
-};
+        assert(!"Unexpected flow");
+        return finishedHandlers;
+    }
 
-struct QmlFutures::impl_t
-{
-    QList<QmlFutures::ContextPtr> contexts;
-};
+    bool isEmpty() const {
+        return finishedHandlers.empty() && resultHandlers.empty() && canceledHandlers.empty() && resultsReadyHandlers.empty() && progressHandlers.empty();
+    }
 
+    // Handler arguments are converted once per completion and shared by all handlers
+    const QJSValueList& canceledArgs() {
+        if (!m_canceledArgs)
+            m_canceledArgs = jsArgs(future);
 
-namespace {
+        return *m_canceledArgs;
+    }
 
-void callJsValue(QJSValue value, QJSValueList& params) {
-    value.call(params);
-}
+    const QJSValueList& fulfilledArgs() {
+        if (!m_fulfilledArgs)
+            m_fulfilledArgs = jsArgs(future, wrapper->resultVariant(), wrapper->resultConverted());
 
-template<typename Arg0, typename... Args>
-void callJsValue(QJSValue value, QJSValueList& params, const Arg0& arg0, const Args&... args) {
-    auto param0 = Init::instance()->engine()->toScriptValue(arg0);
-    params.append(param0);
-    callJsValue(value, params, args...);
-}
+        return *m_fulfilledArgs;
+    }
 
-template<typename... Args>
-void callJsValue(QJSValue value, const Args&... args) {
-    if (!value.isCallable())
-        return;
+    QJSValueList resultsArgs(int begin, int end) const {
+        return jsArgs(future, begin, wrapper->resultsVariant(begin, end), wrapper->resultsConverted(begin, end));
+    }
 
-    QJSValueList list;
-    callJsValue(value, list, args...);
-}
+    static QJSValueList progressArgs(const QVariant& future, const Internal::ProgressInfo& progress) {
+        return jsArgs(future, progress.value, progress.minimum, progress.maximum, progress.text);
+    }
+
+private:
+    std::optional<QJSValueList> m_canceledArgs;
+    std::optional<QJSValueList> m_fulfilledArgs;
+};
+
+struct QmlFutures::impl_t
+{
+    // Location of a registered handler
+    struct HandlerRef
+    {
+        Context* ctx { nullptr };
+        HandlerKind kind { HandlerKind::Finished };
+        HandlerList::iterator it;
+    };
+
+    // Reverse index: handlers guarded by one condition
+    struct ConditionCtx
+    {
+        QSet<int> handlers;
+        QList<QMetaObject::Connection> connections;
+    };
+
+    QHash<FutureId, QmlFutures::ContextPtr> contexts;
+    QHash<int, HandlerRef> handlers;
+    QHash<Condition*, ConditionCtx> conditions;
+    int nextHandlerId { 1 };
+    Dispatcher dispatcher;
+
+    QList<FutureId> pendingResults; // Contexts with new results, flushed by resultsTimer
+    QTimer resultsTimer;
+
+    // Progress throttling: first change is delivered at once and starts progressTimer,
+    // further ones are gathered and delivered on its ticks
+    QList<FutureId> pendingProgress;
+    QTimer progressTimer;
+    qreal progressRate { 30 };
+};
 
-} // namespace
 
 
 QmlFutures::QmlFutures()
 {
     createImpl();
+    impl().resultsTimer.setSingleShot(true);
+    QObject::connect(&impl().resultsTimer, &QTimer::timeout, this, &QmlFutures::flushResults);
+    QObject::connect(&impl().progressTimer, &QTimer::timeout, this, &QmlFutures::flushProgress);
 }
 
 QmlFutures::~QmlFutures()
@@ -74,89 +168,175 @@ bool QmlFutures::isSupportedFuture(const QVariant& value)
     return Init::instance()->isSupportedFuture(value);
 }
 
-void QmlFutures::onFinished(const QVariant& future, const QVariant& context, const QJSValue& handler)
+int QmlFutures::onFinished(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority, bool cancelWhenUnobserved)
 {
     assert(isSupportedFuture(future));
     assert(isNull(context) || isCondition(context));
     assert(handler.isUndefined() || handler.isNull() || handler.isCallable());
+    assert(Internal::isValidEnumValue(priority));
 
     if (isConditionCanceled(context))
-        return;
+        return 0;
 
     if (isFinished(future)) {
         if (isCanceled(future)) {
-            callJsValue(handler, future);
+            return dispatchFinished(priority, handler, jsArgs(future));
         } else {
-            callJsValue(handler, future, resultRawOf(future), resultConvOf(future));
+            return dispatchFinished(priority, handler, jsArgs(future, resultRawOf(future), resultConvOf(future)));
         }
     } else {
-        auto ctx = findOrAppendFutureCtx(future, true);
-        ConditionPtr condition = isNull(context) ? ConditionPtr() : context.value<ConditionPtr>();
-        ctx->finishedHandlers.append({condition, handler});
-
-        if (condition) {
-            QObject::connect(condition.get(), &Condition::isActiveChanged, this, &QmlFutures::conditionChanged);
-            QObject::connect(condition.get(), &Condition::isValidChanged, this, &QmlFutures::conditionChanged);
-        }
+        return appendHandler(HandlerKind::Finished, future, context, handler, priority, cancelWhenUnobserved);
     }
 }
 
-void QmlFutures::onResult(const QVariant& future, const QVariant& context, const QJSValue& handler)
+int QmlFutures::onResult(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority, bool cancelWhenUnobserved)
 {
-    onFulfilled(future, context, handler);
+    return onFulfilled(future, context, handler, priority, cancelWhenUnobserved);
 }
 
-void QmlFutures::onFulfilled(const QVariant& future, const QVariant& context, const QJSValue& handler)
+int QmlFutures::onFulfilled(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority, bool cancelWhenUnobserved)
 {
     assert(isSupportedFuture(future));
     assert(isNull(context) || isCondition(context));
     assert(handler.isUndefined() || handler.isNull() || handler.isCallable());
+    assert(Internal::isValidEnumValue(priority));
 
     if (isConditionCanceled(context))
-        return;
+        return 0;
 
     if (isFulfilled(future)) {
-        callJsValue(handler, future, resultRawOf(future), resultConvOf(future));
+        return dispatchFinished(priority, handler, jsArgs(future, resultRawOf(future), resultConvOf(future)));
     } else {
-        auto ctx = findOrAppendFutureCtx(future, true);
-        ConditionPtr condition = isNull(context) ? ConditionPtr() : context.value<ConditionPtr>();
-        ctx->resultHandlers.append({condition, handler});
-
-        if (condition) {
-            QObject::connect(condition.get(), &Condition::isActiveChanged, this, &QmlFutures::conditionChanged);
-            QObject::connect(condition.get(), &Condition::isValidChanged, this, &QmlFutures::conditionChanged);
-        }
+        return appendHandler(HandlerKind::Fulfilled, future, context, handler, priority, cancelWhenUnobserved);
     }
 }
 
-void QmlFutures::onCanceled(const QVariant& future, const QVariant& context, const QJSValue& handler)
+int QmlFutures::onCanceled(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority)
 {
     assert(isSupportedFuture(future));
     assert(isNull(context) || isCondition(context));
     assert(handler.isUndefined() || handler.isNull() || handler.isCallable());
+    assert(Internal::isValidEnumValue(priority));
 
     if (isConditionCanceled(context))
-        return;
+        return 0;
 
     if (isCanceled(future)) {
-        callJsValue(handler, future);
+        return dispatchFinished(priority, handler, jsArgs(future));
     } else {
-        auto ctx = findOrAppendFutureCtx(future, true);
-        ConditionPtr condition = isNull(context) ? ConditionPtr() : context.value<ConditionPtr>();
-        ctx->canceledHandlers.append({condition, handler});
+        return appendHandler(HandlerKind::Canceled, future, context, handler, priority);
+    }
+}
 
-        if (condition) {
-            QObject::connect(condition.get(), &Condition::isActiveChanged, this, &QmlFutures::conditionChanged);
-            QObject::connect(condition.get(), &Condition::isValidChanged, this, &QmlFutures::conditionChanged);
-        }
+int QmlFutures::onResultsReady(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority)
+{
+    assert(isSupportedFuture(future));
+    assert(isNull(context) || isCondition(context));
+    assert(handler.isUndefined() || handler.isNull() || handler.isCallable());
+    assert(Internal::isValidEnumValue(priority));
+
+    if (isConditionCanceled(context))
+        return 0;
+
+    // All results are known already: single batch, read in place
+    if (isFinished(future)) {
+        const auto init = Init::instance();
+        const auto& ops = init->futureOps(future);
+        const auto count = ops.resultCount(future);
+
+        if (!count)
+            return 0;
+
+        return dispatchFinished(priority, handler, jsArgs(future, 0, ops.resultsVariant(future, 0, count), init->resultsConverted(future, 0, count)));
+    }
+
+    const auto id = appendHandler(HandlerKind::ResultsReady, future, context, handler, priority);
+    auto ctx = findFutureCtx(future);
+    assert(ctx);
+
+    if (!ctx->resultsConnection) {
+        ctx->wrapper->observeResults();
+        ctx->resultsConnection = QObject::connect(ctx->wrapper.get(), &FutureWrapper::resultsReady,
+                                                  this, [this, ctx = ctx.get()](){ scheduleResults(ctx); });
     }
+
+    // Results reported before subscription
+    scheduleResults(ctx.get());
+
+    // Late subscriber catches up with results delivered to others
+    if (ctx->deliveredResults)
+        dispatch(priority, handler, ctx->resultsArgs(0, ctx->deliveredResults), impl().handlers[id].it->condition, id);
+
+    return id;
+}
+
+int QmlFutures::onProgress(const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority)
+{
+    assert(isSupportedFuture(future));
+    assert(isNull(context) || isCondition(context));
+    assert(handler.isUndefined() || handler.isNull() || handler.isCallable());
+    assert(Internal::isValidEnumValue(priority));
+
+    if (isConditionCanceled(context))
+        return 0;
+
+    // Final progress only, read in place
+    if (isFinished(future)) {
+        return dispatchFinished(priority, handler, Context::progressArgs(future, Init::instance()->futureOps(future).progressInfo(future)));
+    }
+
+    const auto id = appendHandler(HandlerKind::Progress, future, context, handler, priority);
+    auto ctx = findFutureCtx(future);
+    assert(ctx);
+
+    if (!ctx->progressConnection)
+        ctx->progressConnection = QObject::connect(ctx->wrapper.get(), &FutureWrapper::progressChanged,
+                                                   this, [this, ctx = ctx.get()](){ progressChanged(ctx); });
+
+    // Late subscriber gets progress delivered to others
+    if (ctx->deliveredProgress != Internal::ProgressInfo())
+        dispatch(priority, handler, Context::progressArgs(ctx->future, ctx->deliveredProgress), impl().handlers[id].it->condition, id);
+
+    // Progress reported before subscription
+    progressChanged(ctx.get());
+    return id;
+}
+
+bool QmlFutures::unsubscribe(int handle)
+{
+    // Handler could also wait in dispatcher: batches queued for running future, or the final call for finished one
+    const auto queued = impl().dispatcher.cancel(handle);
+
+    if (impl().handlers.contains(handle)) {
+        removeHandler(handle);
+        return true;
+    }
+
+    return queued;
+}
+
+QVariantList QmlFutures::onEachFinished(const QVariantList& futures, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority, bool cancelWhenUnobserved)
+{
+    return mapFutures(futures, [&](const QVariant& x){ return onFinished(x, context, handler, priority, cancelWhenUnobserved); });
+}
+
+QVariantList QmlFutures::onEachFulfilled(const QVariantList& futures, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority, bool cancelWhenUnobserved)
+{
+    return mapFutures(futures, [&](const QVariant& x){ return onFulfilled(x, context, handler, priority, cancelWhenUnobserved); });
+}
+
+QVariantList QmlFutures::onEachCanceled(const QVariantList& futures, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority)
+{
+    return mapFutures(futures, [&](const QVariant& x){ return onCanceled(x, context, handler, priority); });
 }
 
 void QmlFutures::forget(const QVariant& future)
 {
     auto ctx = findFutureCtx(future);
-    assert(impl().contexts.contains(ctx));
-    impl().contexts.removeOne(ctx);
+    assert(ctx);
+
+    if (ctx)
+        removeFutureCtx(ctx.get());
 }
 
 void QmlFutures::wait(const QVariant& future)
@@ -166,38 +346,115 @@ void QmlFutures::wait(const QVariant& future)
 
 bool QmlFutures::isRunning(const QVariant& future)
 {
-    return Init::instance()->createFutureWrapper(future)->isRunning();
+    return Init::instance()->futureOps(future).isRunning(future);
 }
 
 bool QmlFutures::isFinished(const QVariant& future)
 {
-    return Init::instance()->createFutureWrapper(future)->isFinished();
+    return Init::instance()->futureOps(future).isFinished(future);
 }
 
 bool QmlFutures::isFulfilled(const QVariant& future)
 {
-    return  Init::instance()->createFutureWrapper(future)->isFinished() &&
-           !Init::instance()->createFutureWrapper(future)->isCanceled();
+    const auto& ops = Init::instance()->futureOps(future);
+    return ops.isFinished(future) && !ops.isCanceled(future);
 }
 
 bool QmlFutures::isCanceled(const QVariant& future)
 {
-    return Init::instance()->createFutureWrapper(future)->isCanceled();
+    return Init::instance()->futureOps(future).isCanceled(future);
 }
 
 QVariant QmlFutures::resultRawOf(const QVariant& future)
 {
-    return Init::instance()->createFutureWrapper(future)->resultVariant();
+    return Init::instance()->futureOps(future).resultVariant(future);
 }
 
 QVariant QmlFutures::resultConvOf(const QVariant& future)
 {
-    return Init::instance()->createFutureWrapper(future)->resultConverted();
+    return Init::instance()->resultConverted(future);
 }
 
 QF::WatcherState QmlFutures::stateOf(const QVariant& future)
 {
-    return Init::instance()->createFutureWrapper(future)->getState();
+    return Init::instance()->futureOps(future).state(future);
+}
+
+QVariantList QmlFutures::statesOf(const QVariantList& futures)
+{
+    const auto init = Init::instance();
+    return mapFutures(futures, [init](const QVariant& x){ return int(init->futureOps(x).state(x)); });
+}
+
+QVariantList QmlFutures::resultsRawOf(const QVariantList& futures)
+{
+    const auto init = Init::instance();
+    return mapFutures(futures, [init](const QVariant& x){ return init->futureOps(x).resultVariant(x); });
+}
+
+QVariantList QmlFutures::resultsConvOf(const QVariantList& futures)
+{
+    const auto init = Init::instance();
+    return mapFutures(futures, [init](const QVariant& x){ return init->resultConverted(x); });
+}
+
+QVariantMap QmlFutures::dispatchStats() const
+{
+    return impl().dispatcher.stats();
+}
+
+void QmlFutures::resetDispatchStats()
+{
+    impl().dispatcher.resetStats();
+}
+
+qreal QmlFutures::dispatchBudget() const
+{
+    return impl().dispatcher.budget();
+}
+
+void QmlFutures::setDispatchBudget(qreal value)
+{
+    if (impl().dispatcher.budget() == value)
+        return;
+
+    impl().dispatcher.setBudget(value);
+    emit dispatchBudgetChanged(value);
+}
+
+QObject* QmlFutures::dispatchWindow() const
+{
+    return impl().dispatcher.window();
+}
+
+void QmlFutures::setDispatchWindow(QObject* value)
+{
+    if (impl().dispatcher.window() == value)
+        return;
+
+    impl().dispatcher.setWindow(value);
+    emit dispatchWindowChanged(value);
+}
+
+qreal QmlFutures::progressRate() const
+{
+    return impl().progressRate;
+}
+
+void QmlFutures::setProgressRate(qreal value)
+{
+    assert(value >= 0);
+
+    if (impl().progressRate == value)
+        return;
+
+    impl().progressRate = value;
+
+    // Gathered changes are delivered right away, new rate is applied to next ones
+    impl().progressTimer.stop();
+    flushProgress();
+
+    emit progressRateChanged(value);
 }
 
 bool QmlFutures::isConditionCanceled(const QVariant& value)
@@ -221,53 +478,29 @@ bool QmlFutures::isCondition(const QVariant& value)
     return Init::instance()->isCondition(value);
 }
 
-#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
-QmlFutures::ContextPtr QmlFutures::findFutureCtx(const QVariant& future)
-{
-    auto it = std::find_if(impl().contexts.begin(), impl().contexts.end(),
-                           [future](const QmlFutures::ContextPtr& item) ->bool
-    {
-        // To Qt6 devs: nice work, guys!
-        auto ptr1 = reinterpret_cast<const QFutureInterfaceBasePrivate* const*>(future.constData());
-        auto ptr2 = reinterpret_cast<const QFutureInterfaceBasePrivate* const*>(item->future.constData());
-
-        if (ptr1 == ptr2)
-            return true;
-
-        return ptr1 && ptr2 && (*ptr1 == *ptr2);
-    });
-
-    return (it == impl().contexts.end()) ? ContextPtr() : *it;
-}
-#else
 QmlFutures::ContextPtr QmlFutures::findFutureCtx(const QVariant& future)
 {
-    auto it = std::find_if(impl().contexts.begin(), impl().contexts.end(),
-                           [future](const QmlFutures::ContextPtr& item) ->bool
-    {
-        return (item->future == future);
-    });
-
-    return (it == impl().contexts.end()) ? ContextPtr() : *it;
+    return impl().contexts.value(Init::instance()->futureId(future));
 }
-#endif
 
 QmlFutures::ContextPtr QmlFutures::findFutureCtx(Context* ctx)
 {
-    auto it = std::find_if(impl().contexts.begin(), impl().contexts.end(), [ctx](const ContextPtr& item){ return item.get() == ctx; });
-    return (it == impl().contexts.end()) ? ContextPtr() : *it;
+    auto it = impl().contexts.constFind(ctx->id);
+    return (it == impl().contexts.constEnd() || it->get() != ctx) ? ContextPtr() : *it;
 }
 
 QmlFutures::ContextPtr QmlFutures::findOrAppendFutureCtx(const QVariant& future, bool append)
 {
-    auto ctx = findFutureCtx(future);
+    const auto id = Init::instance()->futureId(future);
+    auto it = impl().contexts.constFind(id);
 
-    if (ctx)
-        return ctx;
+    if (it != impl().contexts.constEnd())
+        return *it;
 
     if (append) {
-        impl().contexts.append(createFutureCtx(future));
-        return impl().contexts.last();
+        auto ctx = createFutureCtx(future);
+        impl().contexts.insert(ctx->id, ctx);
+        return ctx;
     } else {
         return {};
     }
@@ -278,7 +511,8 @@ QmlFutures::ContextPtr QmlFutures::createFutureCtx(const QVariant& future)
     auto ctx = std::make_shared<QmlFutures::Context>();
     ctx->future = future;
     ctx->wrapper = Init::instance()->createFutureWrapper(future);
-    QObject::connect(ctx->wrapper.get(), &FutureWrapper::stateChanged,
+    ctx->id = ctx->wrapper->id(); // Future without identity of its own gets it from wrapper (Qt5 QFuture<void>)
+    ctx->connection = QObject::connect(ctx->wrapper.get(), &FutureWrapper::stateChanged,
                      this, [this, ctx = ctx.get()]()
     {
         futureChanged(ctx);
@@ -287,73 +521,258 @@ QmlFutures::ContextPtr QmlFutures::createFutureCtx(const QVariant& future)
     return ctx;
 }
 
+void QmlFutures::removeFutureCtx(Context* ctx)
+{
+    for (auto kind : {HandlerKind::Finished, HandlerKind::Fulfilled, HandlerKind::Canceled, HandlerKind::ResultsReady, HandlerKind::Progress}) {
+        for (const auto& x : ctx->handlers(kind)) {
+            impl().handlers.remove(x.id);
+
+            if (x.condition)
+                unlinkCondition(x.condition.get(), x.id);
+        }
+    }
+
+    QObject::disconnect(ctx->connection);
+    QObject::disconnect(ctx->resultsConnection);
+    QObject::disconnect(ctx->progressConnection);
+
+    // No-op for finished future and for one somebody else still observes
+    if (ctx->cancelWhenUnobserved)
+        Init::instance()->cancelIfUnobserved(ctx->wrapper);
+
+    impl().contexts.remove(ctx->id);
+}
+
+int QmlFutures::appendHandler(HandlerKind kind, const QVariant& future, const QVariant& context, const QJSValue& handler, QF::DispatchPriority priority, bool cancelWhenUnobserved)
+{
+    auto ctx = findOrAppendFutureCtx(future, true);
+    ctx->cancelWhenUnobserved = ctx->cancelWhenUnobserved || cancelWhenUnobserved;
+    ConditionPtr condition = isNull(context) ? ConditionPtr() : context.value<ConditionPtr>();
+
+    const auto id = impl().nextHandlerId++;
+    auto& handlers = ctx->handlers(kind);
+    handlers.push_back({id, condition, handler, priority});
+    impl().handlers.insert(id, {ctx.get(), kind, std::prev(handlers.end())});
+
+    if (condition)
+        linkCondition(condition.get(), id);
+
+    return id;
+}
+
+void QmlFutures::removeHandler(int handlerId)
+{
+    auto it = impl().handlers.find(handlerId);
+    assert(it != impl().handlers.end());
+
+    const auto ref = *it;
+    impl().handlers.erase(it);
+
+    const auto condition = ref.it->condition;
+    ref.ctx->handlers(ref.kind).erase(ref.it);
+
+    if (condition)
+        unlinkCondition(condition.get(), handlerId);
+
+    if (ref.ctx->isEmpty())
+        removeFutureCtx(ref.ctx);
+}
+
+void QmlFutures::dispatch(QF::DispatchPriority priority, const QJSValue& handler, const QJSValueList& args, const ConditionPtr& condition, int subscription)
+{
+    impl().dispatcher.dispatch(priority, handler, args, condition, subscription);
+}
+
+int QmlFutures::dispatchFinished(QF::DispatchPriority priority, const QJSValue& handler, const QJSValueList& args)
+{
+    // Nothing to subscribe to, but queued invocation still gets a handle: 'unsubscribe' drops it
+    const auto id = impl().dispatcher.isQueued(priority) ? impl().nextHandlerId++ : 0;
+    dispatch(priority, handler, args, {}, id);
+    return id;
+}
+
+void QmlFutures::linkCondition(Condition* condition, int handlerId)
+{
+    auto it = impl().conditions.find(condition);
+
+    if (it == impl().conditions.end()) {
+        it = impl().conditions.insert(condition, {});
+        it->connections.append(QObject::connect(condition, &Condition::isActiveChanged, this, [this, condition](){ conditionChanged(condition); }));
+        it->connections.append(QObject::connect(condition, &Condition::isValidChanged,  this, [this, condition](){ conditionChanged(condition); }));
+    }
+
+    it->handlers.insert(handlerId);
+}
+
+void QmlFutures::unlinkCondition(Condition* condition, int handlerId)
+{
+    auto it = impl().conditions.find(condition);
+    assert(it != impl().conditions.end());
+
+    it->handlers.remove(handlerId);
+
+    if (it->handlers.isEmpty()) {
+        for (const auto& x : qAsConst(it->connections))
+            QObject::disconnect(x);
+
+        impl().conditions.erase(it);
+    }
+}
+
+void QmlFutures::scheduleResults(Context* ctx)
+{
+    if (ctx->resultsScheduled)
+        return;
+
+    ctx->resultsScheduled = true;
+    impl().pendingResults.append(ctx->id);
+
+    if (!impl().resultsTimer.isActive())
+        impl().resultsTimer.start(0);
+}
+
+void QmlFutures::flushResults()
+{
+    const auto pending = std::move(impl().pendingResults);
+    impl().pendingResults.clear();
+
+    // Context could be finished (and flushed) meanwhile
+    for (const auto& id : pending)
+        if (auto ctx = impl().contexts.value(id))
+            deliverResults(ctx.get());
+}
+
+void QmlFutures::deliverResults(Context* ctx)
+{
+    ctx->resultsScheduled = false;
+
+    // Only results which weren't delivered yet are read, converted once for all handlers
+    const auto begin = ctx->deliveredResults;
+    const auto end = ctx->wrapper->resultCount();
+
+    if (end <= begin)
+        return;
+
+    ctx->deliveredResults = end;
+    const auto args = ctx->resultsArgs(begin, end);
+
+    // Copy: context stays subscribed, synchronous handler could unsubscribe
+    const auto handlers = ctx->resultsReadyHandlers;
+
+    for (const auto& x : handlers)
+        if (impl().handlers.contains(x.id))
+            dispatch(x.priority, x.handler, args, x.condition, x.id);
+}
+
+void QmlFutures::progressChanged(Context* ctx)
+{
+    if (ctx->progressPending)
+        return;
+
+    if (impl().progressTimer.isActive()) {
+        ctx->progressPending = true;
+        impl().pendingProgress.append(ctx->id);
+        return;
+    }
+
+    deliverProgress(ctx);
+
+    if (impl().progressRate > 0)
+        impl().progressTimer.start(int(1000 / impl().progressRate));
+}
+
+void QmlFutures::flushProgress()
+{
+    // Nothing changed within the last interval: throttling ends
+    if (impl().pendingProgress.isEmpty()) {
+        impl().progressTimer.stop();
+        return;
+    }
+
+    const auto pending = std::move(impl().pendingProgress);
+    impl().pendingProgress.clear();
+
+    for (const auto& id : pending)
+        if (auto ctx = impl().contexts.value(id))
+            deliverProgress(ctx.get());
+}
+
+void QmlFutures::deliverProgress(Context* ctx)
+{
+    ctx->progressPending = false;
+
+    const auto progress = ctx->wrapper->progressInfo();
+
+    if (progress == ctx->deliveredProgress)
+        return;
+
+    ctx->deliveredProgress = progress;
+    const auto args = Context::progressArgs(ctx->future, progress);
+
+    // Copy: context stays subscribed, synchronous handler could unsubscribe
+    const auto handlers = ctx->progressHandlers;
+
+    for (const auto& x : handlers)
+        if (impl().handlers.contains(x.id))
+            dispatch(x.priority, x.handler, args, x.condition, x.id);
+}
+
 void QmlFutures::futureChanged(Context* ctxPtr)
 {
     auto ctx = findFutureCtx(ctxPtr);
     assert(ctx);
 
     if (ctx->wrapper->isFinished()) {
-        forget(ctx->future);
+        // Last batch and final progress go before 'finished'
+        if (!ctx->resultsReadyHandlers.empty())
+            deliverResults(ctx.get());
 
-        if (ctx->wrapper->isCanceled()) {
-            for (const auto& x : qAsConst(ctx->finishedHandlers)) {
-                assert(!x.condition || x.condition->isActive());
-                callJsValue(x.handler, ctx->future);
-            }
-        } else {
-            for (const auto& x : qAsConst(ctx->finishedHandlers)) {
-                assert(!x.condition || x.condition->isActive());
-                callJsValue(x.handler, ctx->future, resultRawOf(ctx->future), resultConvOf(ctx->future));
-            }
+        if (!ctx->progressHandlers.empty())
+            deliverProgress(ctx.get());
+
+        // Handlers could unsubscribe all
+        if (!findFutureCtx(ctx.get()))
+            return;
+
+        removeFutureCtx(ctx.get());
+
+        const auto& args = ctx->wrapper->isCanceled() ? ctx->canceledArgs() : ctx->fulfilledArgs();
+
+        for (const auto& x : qAsConst(ctx->finishedHandlers)) {
+            assert(!x.condition || x.condition->isActive());
+            dispatch(x.priority, x.handler, args, x.condition, x.id);
         }
     }
 
     if (ctx->wrapper->isCanceled()) {
         for (const auto& x : qAsConst(ctx->canceledHandlers)) {
             assert(!x.condition || x.condition->isActive());
-            callJsValue(x.handler, ctx->future);
+            dispatch(x.priority, x.handler, ctx->canceledArgs(), x.condition, x.id);
         }
     }
 
     if (ctx->wrapper->isFulfilled()) {
         for (const auto& x : qAsConst(ctx->resultHandlers)) {
             assert(!x.condition || x.condition->isActive());
-            callJsValue(x.handler, ctx->future, resultRawOf(ctx->future), resultConvOf(ctx->future));
+            dispatch(x.priority, x.handler, ctx->fulfilledArgs(), x.condition, x.id);
         }
     }
 }
 
-void QmlFutures::conditionChanged()
+void QmlFutures::conditionChanged(Condition* condition)
 {
-    auto it = impl().contexts.begin();
-    while (it != impl().contexts.end()) {
-        auto hIt = it->get()->finishedHandlers.begin();
-        while (hIt != it->get()->finishedHandlers.end()) {
-            auto remove = (hIt->condition && (!hIt->condition->isActive() || !hIt->condition->isValid()));
-            if (remove) hIt->condition->disconnect(this);
-            hIt = remove ? it->get()->finishedHandlers.erase(hIt) : hIt + 1;
-        }
-
-        hIt = it->get()->resultHandlers.begin();
-        while (hIt != it->get()->resultHandlers.end()) {
-            auto remove = (hIt->condition && (!hIt->condition->isActive() || !hIt->condition->isValid()));
-            if (remove) hIt->condition->disconnect(this);
-            hIt = remove ? it->get()->resultHandlers.erase(hIt) : hIt + 1;
-        }
+    if (condition->isActive() && condition->isValid())
+        return;
 
-        hIt = it->get()->canceledHandlers.begin();
-        while (hIt != it->get()->canceledHandlers.end()) {
-            auto remove = (hIt->condition && (!hIt->condition->isActive() || !hIt->condition->isValid()));
-            if (remove) hIt->condition->disconnect(this);
-            hIt = remove ? it->get()->canceledHandlers.erase(hIt) : hIt + 1;
-        }
+    auto it = impl().conditions.constFind(condition);
+    if (it == impl().conditions.constEnd())
+        return;
 
-        auto remove = it->get()->finishedHandlers.isEmpty() &&
-                      it->get()->resultHandlers.isEmpty() &&
-                      it->get()->canceledHandlers.isEmpty();
+    // Copy: removal of the last handler drops the whole entry
+    const auto handlers = it->handlers;
 
-        it = remove ? impl().contexts.erase(it) : it + 1;
-    }
+    for (auto id : handlers)
+        removeHandler(id);
 }
 
 void QmlFutures::registerTypes()
@@ -4,16 +4,1109 @@
 
 #include <benchmark/benchmark.h>
 
-static void StubBenchmark(benchmark::State& state)
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QTimer>
+#include <QQmlEngine>
+#include <QQmlComponent>
+#include <QQmlContext>
+#include <QJSValue>
+#include <QFutureInterface>
+#include <QFutureWatcher>
+#include <QVariant>
+#include <QThreadPool>
+#include <QThread>
+#include <QElapsedTimer>
+#include <QtConcurrent>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <QmlFutures/Init.h>
+#include <QmlFutures/QF.h>
+#include <QmlFutures/QmlFutures.h>
+#include <QmlFutures/QmlFutureWatcher.h>
+#include <QmlFutures/FutureListModel.h>
+
+namespace {
+
+std::atomic<size_t> allocationsCounter { 0 };
+std::atomic<size_t> allocatedBytesCounter { 0 };
+
+} // namespace
+
+// Counting allocator, used for "allocations per operation" counters
+void* operator new(std::size_t size)
+{
+    allocationsCounter.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytesCounter.fetch_add(size, std::memory_order_relaxed);
+
+    if (auto ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace {
+
+size_t allocations()
+{
+    return allocationsCounter.load(std::memory_order_relaxed);
+}
+
+size_t allocatedBytes()
+{
+    return allocatedBytesCounter.load(std::memory_order_relaxed);
+}
+
+// Adds allocation counters normalized by number of processed items
+void setAllocationCounters(benchmark::State& state, size_t allocationsSum, size_t bytesSum, double items, const char* suffix)
+{
+    state.counters[std::string("allocs/") + suffix] = double(allocationsSum) / items;
+    state.counters[std::string("bytes/") + suffix] = double(bytesSum) / items;
+}
+
+// Counts events delivered in GUI thread which carry future notifications
+class NotificationEventsCounter : public QObject
+{
+public:
+    bool eventFilter(QObject* watched, QEvent* event) override {
+        if (event->type() == QEvent::MetaCall || event->type() == QEvent::FutureCallOut)
+            count++;
+
+        return QObject::eventFilter(watched, event);
+    }
+
+    size_t count { 0 };
+};
+
+// Counts binding evaluations, called from QML as 'evaluationsCounter.hit()'
+class EvaluationsCounter : public QObject
+{
+    Q_OBJECT
+public:
+    Q_INVOKABLE void hit() { count++; }
+
+    size_t count { 0 };
+};
+
+void waitForFinished(const QVariantList& futures)
+{
+    auto qmlFutures = QmlFutures::QmlFutures::instance();
+
+    for (const auto& x : futures)
+        while (!qmlFutures->isFinished(x))
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+}
+
+QJSValue emptyHandler()
+{
+    return QmlFutures::Init::instance()->engine()->evaluate("(function(){})");
+}
+
+QVariant pendingFuture(QFutureInterface<QVariant>& interface)
+{
+    interface.reportStarted();
+    return QVariant::fromValue(interface.future());
+}
+
+QVariant finishedFuture(const QVariant& result)
+{
+    QFutureInterface<QVariant> interface;
+    interface.reportStarted();
+    interface.reportResult(result);
+    interface.reportFinished();
+    return QVariant::fromValue(interface.future());
+}
+
+// 'objectName' is used as a cheap notifiable property for conditions
+QVariant objectNameCondition(QObject& object)
 {
-    int i = 0;
+    object.setObjectName("on");
+    return QmlFutures::QF::instance()->conditionProp(&object, "objectName", "on", QmlFutures::QF::Comparison::Equal);
+}
+
+} // namespace
+
+
+// Cost of registering (and forgetting) one handler while N other futures are being watched
+static void QmlFutures_Registration(benchmark::State& state)
+{
+    auto qmlFutures = QmlFutures::QmlFutures::instance();
+    const auto handler = emptyHandler();
+
+    std::vector<QFutureInterface<QVariant>> interfaces(state.range(0));
+    QVariantList futures;
+    futures.reserve(interfaces.size());
+
+    for (auto& x : interfaces) {
+        futures.append(pendingFuture(x));
+        qmlFutures->onFinished(futures.last(), QVariant(), handler);
+    }
+
+    QFutureInterface<QVariant> probeInterface;
+    const auto probe = pendingFuture(probeInterface);
+
+    while (state.KeepRunning()) {
+        qmlFutures->onFinished(probe, QVariant(), handler);
+        qmlFutures->forget(probe);
+    }
+
+    for (const auto& x : futures)
+        qmlFutures->forget(x);
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(QmlFutures_Registration)->RangeMultiplier(10)->Range(10, 100000);
+
+// Condition flip invalidating one handler while N other guarded handlers are alive
+static void QmlFutures_ConditionFlip(benchmark::State& state)
+{
+    auto qmlFutures = QmlFutures::QmlFutures::instance();
+    const auto handler = emptyHandler();
+
+    std::vector<QFutureInterface<QVariant>> interfaces(state.range(0));
+    std::vector<std::unique_ptr<QObject>> objects;
+    QVariantList futures;
+    futures.reserve(interfaces.size());
+    objects.reserve(interfaces.size());
+
+    for (auto& x : interfaces) {
+        objects.push_back(std::make_unique<QObject>());
+        futures.append(pendingFuture(x));
+        qmlFutures->onFinished(futures.last(), objectNameCondition(*objects.back()), handler);
+    }
+
+    QObject hotObject;
+    QFutureInterface<QVariant> probeInterface;
+    const auto probe = pendingFuture(probeInterface);
+
+    while (state.KeepRunning()) {
+        qmlFutures->onFinished(probe, objectNameCondition(hotObject), handler);
+        hotObject.setObjectName("off");
+    }
+
+    for (const auto& x : futures)
+        qmlFutures->forget(x);
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(QmlFutures_ConditionFlip)->RangeMultiplier(10)->Range(100, 10000);
+
+// Completion fan-out: one future with a large result, many handlers
+static void QmlFutures_CompletionFanOut(benchmark::State& state)
+{
+    auto qmlFutures = QmlFutures::QmlFutures::instance();
+    auto counter = QmlFutures::Init::instance()->engine()->evaluate(
+        "(function(){ var n = 0; return { handler: function(){ ++n; }, count: function(){ return n; } }; })()");
+    const auto handler = counter.property("handler");
+    auto count = counter.property("count");
+    const auto handlersCount = state.range(0);
+
+    QVariantMap result;
+    for (int i = 0; i < 1000; i++)
+        result.insert(QString::number(i), i);
+
+    while (state.KeepRunning()) {
+        QFutureInterface<QVariant> interface;
+        const auto future = pendingFuture(interface);
+
+        for (int i = 0; i < handlersCount; i++)
+            qmlFutures->onFulfilled(future, QVariant(), handler);
+
+        const auto expected = count.call().toInt() + handlersCount;
+        interface.reportResult(QVariant(result));
+        interface.reportFinished();
+
+        while (count.call().toInt() < expected)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+
+    state.SetItemsProcessed(state.iterations() * handlersCount);
+}
+BENCHMARK(QmlFutures_CompletionFanOut)->RangeMultiplier(5)->Range(1, 50);
+
+// State queries, which are expected to be allocation-free
+static void QmlFutures_StateProbe(benchmark::State& state)
+{
+    auto qmlFutures = QmlFutures::QmlFutures::instance();
+    const auto future = finishedFuture(42);
+    bool flags = false;
+
+    const auto allocationsBefore = allocations();
+
+    while (state.KeepRunning()) {
+        flags ^= qmlFutures->isFinished(future);
+        flags ^= qmlFutures->isCanceled(future);
+        flags ^= qmlFutures->isFulfilled(future);
+        benchmark::DoNotOptimize(qmlFutures->stateOf(future));
+        benchmark::DoNotOptimize(qmlFutures->resultRawOf(future));
+        benchmark::DoNotOptimize(qmlFutures->resultConvOf(future));
+    }
+
+    benchmark::DoNotOptimize(flags);
+    state.SetItemsProcessed(state.iterations() * 6);
+    state.counters["allocs/query"] = benchmark::Counter(double(allocations() - allocationsBefore) / 6,
+                                                        benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(QmlFutures_StateProbe);
+
+// Type dispatch: registered futures of several types plus unsupported values
+static void Init_IsSupportedFuture(benchmark::State& state)
+{
+    auto init = QmlFutures::Init::instance();
+    const QVariantList values {
+        finishedFuture(42),
+        QVariant::fromValue(QFuture<void>()),
+        QVariant(QStringLiteral("not a future")),
+        QVariant()
+    };
+    bool flags = false;
 
     while (state.KeepRunning())
-        i++;
+        for (const auto& x : values)
+            flags ^= init->isSupportedFuture(x);
+
+    benchmark::DoNotOptimize(flags);
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(Init_IsSupportedFuture);
+
+static void Init_CreateFutureWrapper(benchmark::State& state)
+{
+    auto init = QmlFutures::Init::instance();
+    const QVariantList values {
+        finishedFuture(42),
+        QVariant::fromValue(QFuture<void>())
+    };
+
+    while (state.KeepRunning())
+        for (const auto& x : values)
+            benchmark::DoNotOptimize(init->createFutureWrapper(x));
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(Init_CreateFutureWrapper);
+
+// Timed futures, all owned by QF (single QTimer + min-heap)
+static void QF_TimedFutures(benchmark::State& state)
+{
+    auto qf = QmlFutures::QF::instance();
+    const auto count = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
+
+    QVariantList futures;
+    futures.reserve(count);
+
+    while (state.KeepRunning()) {
+        futures.clear();
+
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        for (int i = 0; i < count; i++)
+            futures.append(qf->createTimedFuture(i, 1));
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+
+        waitForFinished(futures);
+    }
+
+    const auto total = double(state.iterations() * count);
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["allocs/future"] = double(allocationsSum) / total;
+    state.counters["bytes/future"] = double(bytesSum) / total;
+}
+
+BENCHMARK(QF_TimedFutures)->RangeMultiplier(10)->Range(1, 10000)->Unit(benchmark::kMillisecond);
+
+// Reference: previous design with one QTimer per timed future
+static void QF_TimedFutures_PerTimerBaseline(benchmark::State& state)
+{
+    struct TimedFuture
+    {
+        QFutureInterface<QVariant> interface;
+        QTimer timer;
+    };
+
+    const auto count = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
+
+    std::vector<std::unique_ptr<TimedFuture>> timedFutures;
+    QVariantList futures;
+    timedFutures.reserve(count);
+    futures.reserve(count);
+
+    while (state.KeepRunning()) {
+        timedFutures.clear();
+        futures.clear();
+
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        for (int i = 0; i < count; i++) {
+            timedFutures.push_back(std::make_unique<TimedFuture>());
+            auto ptr = timedFutures.back().get();
+
+            ptr->interface.reportStarted();
+            ptr->timer.setSingleShot(true);
+            QObject::connect(&ptr->timer, &QTimer::timeout, &ptr->timer, [ptr, i](){
+                ptr->interface.reportResult(QVariant(i));
+                ptr->interface.reportFinished();
+            }, Qt::QueuedConnection);
+            ptr->timer.start(1);
+
+            futures.append(QVariant::fromValue(ptr->interface.future()));
+        }
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+
+        waitForFinished(futures);
+    }
+
+    const auto total = double(state.iterations() * count);
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["allocs/future"] = double(allocationsSum) / total;
+    state.counters["bytes/future"] = double(bytesSum) / total;
+}
+
+BENCHMARK(QF_TimedFutures_PerTimerBaseline)->RangeMultiplier(10)->Range(1, 10000)->Unit(benchmark::kMillisecond);
+
+
+// QmlFutureWatcher: rebinding one watcher across pending and finished futures
+static void QmlFutureWatcher_SetFutureChurn(benchmark::State& state)
+{
+    QmlFutures::QmlFutureWatcher watcher;
+    const auto count = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
+
+    std::vector<QFutureInterface<QVariant>> interfaces(count);
+    QVariantList futures;
+    futures.reserve(count * 2);
+
+    for (auto& x : interfaces) {
+        futures.append(pendingFuture(x));
+        futures.append(finishedFuture(42));
+    }
+
+    while (state.KeepRunning()) {
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        for (const auto& x : qAsConst(futures))
+            watcher.setFuture(x);
+
+        watcher.setFuture(QVariant());
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+    }
+
+    const auto total = double(state.iterations() * futures.size());
+    state.SetItemsProcessed(state.iterations() * futures.size());
+    setAllocationCounters(state, allocationsSum, bytesSum, total, "setFuture");
+}
+
+BENCHMARK(QmlFutureWatcher_SetFutureChurn)->RangeMultiplier(100)->Range(1, 10000);
+
+// Completion observation of N distinct futures, one QFutureWatcher each
+static void FutureWrapper_Completion(benchmark::State& state)
+{
+    auto init = QmlFutures::Init::instance();
+    const auto count = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
+    int notified = 0;
+
+    while (state.KeepRunning()) {
+        std::vector<QFutureInterface<QVariant>> interfaces(count);
+        std::vector<std::shared_ptr<QmlFutures::FutureWrapper>> wrappers;
+        wrappers.reserve(count);
+        notified = 0;
+
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        for (auto& x : interfaces) {
+            wrappers.push_back(init->createFutureWrapper(pendingFuture(x)));
+            QObject::connect(wrappers.back().get(), &QmlFutures::FutureWrapper::stateChanged, [&notified](){ notified++; });
+        }
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+
+        for (auto& x : interfaces) {
+            x.reportResult(QVariant(1));
+            x.reportFinished();
+        }
+
+        while (notified < count)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+
+    const auto total = double(state.iterations() * count);
+    state.SetItemsProcessed(state.iterations() * count);
+    setAllocationCounters(state, allocationsSum, bytesSum, total, "future");
+}
+
+BENCHMARK(FutureWrapper_Completion)->RangeMultiplier(100)->Range(1, 10000)->Unit(benchmark::kMillisecond);
+
+// Thousands of QtConcurrent tasks finished by 8..64 producer threads at once:
+// GUI thread events per future and completion-to-delivery latency.
+// Every future is observed by its QFutureWatcher, completions aren't batched: one callout event per future.
+static void FutureWrapper_CrossThreadDelivery(benchmark::State& state)
+{
+    auto init = QmlFutures::Init::instance();
+    const int count = 10000;
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(int(state.range(0)));
+
+    NotificationEventsCounter eventsCounter;
+    QCoreApplication::instance()->installEventFilter(&eventsCounter);
+
+    QElapsedTimer clock;
+    clock.start();
+
+    std::vector<qint64> finishedAt(count);
+    std::vector<qint64> latencies;
+    size_t eventsSum = 0;
+
+    while (state.KeepRunning()) {
+        std::vector<std::shared_ptr<QmlFutures::FutureWrapper>> wrappers;
+        wrappers.reserve(count);
+        int delivered = 0;
+
+        const auto eventsBefore = eventsCounter.count;
+
+        for (int i = 0; i < count; i++) {
+            auto future = QtConcurrent::run(&pool, [i, &finishedAt, &clock]() -> QVariant {
+                finishedAt[i] = clock.nsecsElapsed();
+                return i;
+            });
+
+            wrappers.push_back(init->createFutureWrapper(QVariant::fromValue(future)));
+            auto wrapper = wrappers.back().get();
+
+            QObject::connect(wrapper, &QmlFutures::FutureWrapper::stateChanged, [wrapper, i, &finishedAt, &latencies, &clock, &delivered](){
+                if (!wrapper->isFinished())
+                    return;
+
+                latencies.push_back(clock.nsecsElapsed() - finishedAt[i]);
+                delivered++;
+            });
+        }
+
+        while (delivered < count)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        eventsSum += eventsCounter.count - eventsBefore;
+    }
+
+    pool.waitForDone();
+    QCoreApplication::instance()->removeEventFilter(&eventsCounter);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentileUs = [&latencies](double p) { return double(latencies[size_t(p * double(latencies.size() - 1))]) / 1000.0; };
+
+    const auto total = double(state.iterations() * count);
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["events/future"] = double(eventsSum) / total;
+    state.counters["p50_us"] = percentileUs(0.5);
+    state.counters["p99_us"] = percentileUs(0.99);
+    state.counters["max_us"] = percentileUs(1.0);
+}
+
+BENCHMARK(FutureWrapper_CrossThreadDelivery)->RangeMultiplier(2)->Range(8, 64)->Unit(benchmark::kMillisecond);
+
+// N watchers of one future: memory per observer and completion fan-out latency
+static void QmlFutureWatcher_SharedFutureFanOut(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
 
-    (void)i;
+    while (state.KeepRunning()) {
+        QFutureInterface<QVariant> interface;
+        const auto future = pendingFuture(interface);
+        std::vector<std::unique_ptr<QmlFutures::QmlFutureWatcher>> watchers;
+        watchers.reserve(count);
+
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        for (int i = 0; i < count; i++) {
+            watchers.push_back(std::make_unique<QmlFutures::QmlFutureWatcher>());
+            watchers.back()->setFuture(future);
+        }
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+
+        interface.reportResult(QVariant(42));
+        interface.reportFinished();
+
+        while (!watchers.back()->isFinished())
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        state.PauseTiming();
+        watchers.clear();
+        state.ResumeTiming();
+    }
+
+    const auto total = double(state.iterations() * count);
+    state.SetItemsProcessed(state.iterations() * count);
+    setAllocationCounters(state, allocationsSum, bytesSum, total, "observer");
+}
+
+BENCHMARK(QmlFutureWatcher_SharedFutureFanOut)->RangeMultiplier(10)->Range(1, 1000)->Unit(benchmark::kMicrosecond);
+
+// Binding re-evaluations caused by one completion (and by reset) of delegate-like watchers
+static void QmlFutureWatcher_BindingEvaluations(benchmark::State& state)
+{
+    auto engine = QmlFutures::Init::instance()->engine();
+    const auto count = state.range(0);
+
+    EvaluationsCounter counter;
+    engine->rootContext()->setContextProperty("evaluationsCounter", &counter);
+
+    QQmlComponent component(engine);
+    component.setData("import QtQml 2.2\n"
+                      "import QmlFutures 1.0\n"
+                      "QtObject {\n"
+                      "    property QtObject watcher: QmlFutureWatcher { }\n"
+                      "    property bool busy: { evaluationsCounter.hit(); return !watcher.isFinished; }\n"
+                      "    property int state: { evaluationsCounter.hit(); return watcher.state; }\n"
+                      "}\n", QUrl());
+    if (!component.isReady()) {
+        state.SkipWithError(qPrintable(component.errorString()));
+        return;
+    }
+
+    std::vector<std::unique_ptr<QObject>> delegates;
+    delegates.reserve(count);
+
+    for (int i = 0; i < count; i++)
+        delegates.emplace_back(component.create());
+
+    // Both bindings are evaluated on creation, otherwise nothing below is measured
+    if (counter.count < size_t(2 * count)) {
+        state.SkipWithError("Bindings aren't evaluated, counter isn't reachable from QML");
+        engine->rootContext()->setContextProperty("evaluationsCounter", nullptr);
+        return;
+    }
+
+    size_t evaluationsSum = 0;
+
+    while (state.KeepRunning()) {
+        QFutureInterface<QVariant> interface;
+        const auto future = pendingFuture(interface);
+
+        for (const auto& x : delegates)
+            x->property("watcher").value<QObject*>()->setProperty("future", future);
+
+        const auto evaluationsBefore = counter.count;
+
+        interface.reportResult(QVariant(42));
+        interface.reportFinished();
+
+        auto lastWatcher = qobject_cast<QmlFutures::QmlFutureWatcher*>(delegates.back()->property("watcher").value<QObject*>());
+        while (!lastWatcher->isFinished())
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        evaluationsSum += counter.count - evaluationsBefore;
+    }
+
+    delegates.clear();
+    engine->rootContext()->setContextProperty("evaluationsCounter", nullptr);
+
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["evals/completion"] = double(evaluationsSum) / double(state.iterations() * count);
+}
+
+BENCHMARK(QmlFutureWatcher_BindingEvaluations)->RangeMultiplier(10)->Range(10, 2000)->Unit(benchmark::kMillisecond);
+
+// QF.createFuture: N futures chained to pending sources, then all sources completed
+static void QF_CreateFuture(benchmark::State& state)
+{
+    auto qf = QmlFutures::QF::instance();
+    const auto count = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
+
+    QVariantList futures;
+    futures.reserve(count);
+
+    while (state.KeepRunning()) {
+        std::vector<QFutureInterface<QVariant>> interfaces(count);
+        futures.clear();
+
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        for (auto& x : interfaces)
+            futures.append(qf->createFuture(pendingFuture(x), QVariant()));
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+
+        for (auto& x : interfaces) {
+            x.reportResult(QVariant(1));
+            x.reportFinished();
+        }
+
+        waitForFinished(futures);
+    }
+
+    const auto total = double(state.iterations() * count);
+    state.SetItemsProcessed(state.iterations() * count);
+    setAllocationCounters(state, allocationsSum, bytesSum, total, "future");
+}
+
+BENCHMARK(QF_CreateFuture)->RangeMultiplier(100)->Range(1, 10000)->Unit(benchmark::kMillisecond);
+
+// QF.combine: one combined future over N pending sources, completed one by one
+static void QF_Combine(benchmark::State& state)
+{
+    auto qf = QmlFutures::QF::instance();
+    const auto count = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
+
+    QVariantList sources;
+    sources.reserve(count);
+
+    while (state.KeepRunning()) {
+        std::vector<QFutureInterface<QVariant>> interfaces(count);
+        sources.clear();
+
+        for (auto& x : interfaces)
+            sources.append(pendingFuture(x));
+
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        const auto combined = qf->combine(QmlFutures::QF::CombineTrigger::All, QVariant(), sources);
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+
+        for (auto& x : interfaces) {
+            x.reportResult(QVariant(1));
+            x.reportFinished();
+        }
+
+        waitForFinished({combined});
+    }
+
+    const auto total = double(state.iterations() * count);
+    state.SetItemsProcessed(state.iterations() * count);
+    setAllocationCounters(state, allocationsSum, bytesSum, total, "source");
 }
 
-BENCHMARK(StubBenchmark);
+BENCHMARK(QF_Combine)->RangeMultiplier(100)->Range(1, 10000)->Unit(benchmark::kMillisecond);
+
+// Cross-thread completion: futures finished by QtConcurrent, handlers run in GUI thread
+static void QmlFutures_CrossThreadCompletion(benchmark::State& state)
+{
+    auto qmlFutures = QmlFutures::QmlFutures::instance();
+    auto counter = QmlFutures::Init::instance()->engine()->evaluate(
+        "(function(){ var n = 0; return { handler: function(){ ++n; }, count: function(){ return n; } }; })()");
+    const auto handler = counter.property("handler");
+    auto count = counter.property("count");
+    const auto futuresCount = state.range(0);
+    size_t allocationsSum = 0;
+    size_t bytesSum = 0;
+
+    while (state.KeepRunning()) {
+        const auto expected = count.call().toInt() + futuresCount;
+
+        const auto allocationsBefore = allocations();
+        const auto bytesBefore = allocatedBytes();
+
+        for (int i = 0; i < futuresCount; i++) {
+            const auto future = QVariant::fromValue(QtConcurrent::run([i]() -> QVariant { return i; }));
+            qmlFutures->onFinished(future, QVariant(), handler);
+        }
+
+        while (count.call().toInt() < expected)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        allocationsSum += allocations() - allocationsBefore;
+        bytesSum += allocatedBytes() - bytesBefore;
+    }
+
+    QThreadPool::globalInstance()->waitForDone();
+
+    const auto total = double(state.iterations() * futuresCount);
+    state.SetItemsProcessed(state.iterations() * futuresCount);
+    setAllocationCounters(state, allocationsSum, bytesSum, total, "future");
+}
+
+BENCHMARK(QmlFutures_CrossThreadCompletion)->RangeMultiplier(100)->Range(1, 10000)->Unit(benchmark::kMillisecond);
+
+
+// Time from reportFinished() to QmlFutureWatcher::fulfilled(), per delivery mode
+static void QmlFutureWatcher_DeliveryLatency(benchmark::State& state)
+{
+    const auto mode = QmlFutures::QF::DeliveryMode(state.range(0));
+    QmlFutures::QmlFutureWatcher watcher;
+    watcher.setDeliveryMode(mode);
+
+    QElapsedTimer clock;
+    clock.start();
+    qint64 fulfilledAt = -1;
+    size_t events = 0;
+
+    QObject::connect(&watcher, &QmlFutures::QmlFutureWatcher::fulfilled, [&](){ fulfilledAt = clock.nsecsElapsed(); });
+
+    NotificationEventsCounter counter;
+    QCoreApplication::instance()->installEventFilter(&counter);
+
+    while (state.KeepRunning()) {
+        QFutureInterface<QVariant> interface;
+        watcher.setFuture(pendingFuture(interface));
+        QCoreApplication::processEvents();
+
+        const auto eventsBefore = counter.count;
+        fulfilledAt = -1;
+        const auto completedAt = clock.nsecsElapsed();
+        interface.reportResult(QVariant(42));
+        interface.reportFinished();
+
+        while (fulfilledAt < 0)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        events += counter.count - eventsBefore;
+        state.SetIterationTime(double(fulfilledAt - completedAt) / 1e9);
+
+        state.PauseTiming();
+        watcher.setFuture(QVariant());
+        state.ResumeTiming();
+    }
+
+    QCoreApplication::instance()->removeEventFilter(&counter);
+    state.counters["events/completion"] = double(events) / state.iterations();
+}
+
+BENCHMARK(QmlFutureWatcher_DeliveryLatency)
+    ->ArgName("mode") // 0 - Queued, 1 - Direct, 2 - Coalesced
+    ->DenseRange(0, 2)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+
+// Scrolling delegates of 'reuseItems' view over 100k rows of finished futures: one row per step.
+// Arg: 0 - delegate just rebinds 'future', 1 - delegate is pooled / reused
+static void QmlFutureWatcher_ReuseScroll(benchmark::State& state)
+{
+    constexpr int RowsCount = 100000;
+    constexpr int DelegatesCount = 20;
+    const bool recycle = state.range(0);
+
+    std::vector<QVariant> rows;
+    rows.reserve(RowsCount);
+    for (int i = 0; i < RowsCount; i++)
+        rows.push_back(finishedFuture(QVariant(i)));
+
+    std::vector<std::unique_ptr<QmlFutures::QmlFutureWatcher>> delegates;
+    for (int i = 0; i < DelegatesCount; i++) {
+        delegates.push_back(std::make_unique<QmlFutures::QmlFutureWatcher>());
+        delegates.back()->setFuture(rows[i]);
+    }
+
+    QCoreApplication::processEvents();
+
+    int top = 0;
+    const auto allocationsBefore = allocations();
+    const auto bytesBefore = allocatedBytes();
+
+    while (state.KeepRunning()) {
+        auto& delegate = delegates[top % DelegatesCount];
+        const auto& row = rows[(top + DelegatesCount) % RowsCount];
+
+        if (recycle) {
+            delegate->pool();
+            delegate->setFuture(row);
+            delegate->reuse();
+        } else {
+            delegate->setFuture(row);
+        }
+
+        // Posted notifications are handled once per screen
+        if (++top % DelegatesCount == 0)
+            QCoreApplication::processEvents();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    setAllocationCounters(state, allocations() - allocationsBefore, allocatedBytes() - bytesBefore, double(state.iterations()), "reuse");
+
+    delegates.clear();
+    QCoreApplication::processEvents();
+}
+
+BENCHMARK(QmlFutureWatcher_ReuseScroll)->ArgName("recycle")->DenseRange(0, 1);
+
+
+// Job table: all rows of FutureListModel finish at once, cost of tracking and reporting them
+static void FutureListModel_BatchCompletion(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    size_t rangesSum = 0;
+
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        std::vector<QFutureInterface<QVariant>> interfaces(static_cast<size_t>(count));
+        QVariantList futures;
+        for (auto& x : interfaces)
+            futures.append(pendingFuture(x));
+        state.ResumeTiming();
+
+        QmlFutures::FutureListModel model;
+        size_t ranges = 0;
+        QObject::connect(&model, &QAbstractItemModel::dataChanged, [&ranges](){ ranges++; });
+
+        model.appendAll(futures);
+
+        for (auto& x : interfaces) {
+            x.reportResult(QVariant(42));
+            x.reportFinished();
+        }
+
+        while (!model.data(model.index(int(count) - 1), QmlFutures::FutureListModel::IsFinishedRole).toBool() || !ranges)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        QCoreApplication::processEvents();
+        rangesSum += ranges;
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["dataChanged/batch"] = double(rangesSum) / state.iterations();
+}
+
+BENCHMARK(FutureListModel_BatchCompletion)->RangeMultiplier(10)->Range(100, 50000)->Unit(benchmark::kMillisecond);
+
+
+// Worker reports 'count' results one by one, QmlFutureWatcher streams them in coalesced batches
+static void QmlFutureWatcher_StreamedResults(benchmark::State& state)
+{
+    const auto count = int(state.range(0));
+    size_t batchesSum = 0;
+
+    while (state.KeepRunning()) {
+        QmlFutures::QmlFutureWatcher watcher;
+        int received = 0;
+        size_t batches = 0;
+
+        QObject::connect(&watcher, &QmlFutures::QmlFutureWatcher::resultsReady, [&](int, const QVariantList& results){
+            received += int(results.size());
+            batches++;
+        });
+
+        QFutureInterface<QVariant> interface;
+        watcher.setFuture(pendingFuture(interface));
+
+        auto worker = QtConcurrent::run([&interface, count](){
+            for (int i = 0; i < count; i++)
+                interface.reportResult(QVariant(i), i);
+
+            interface.reportFinished();
+        });
+
+        while (!watcher.isFinished())
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        worker.waitForFinished();
+
+        if (received != count)
+            state.SkipWithError("Not all results were delivered");
+
+        batchesSum += batches;
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["batches"] = double(batchesSum) / state.iterations();
+}
+
+BENCHMARK(QmlFutureWatcher_StreamedResults)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
+
+
+// Worker floods progress (value and range), QmlFutureWatcher surfaces at most 'progressRate' updates per second
+static void QmlFutureWatcher_ProgressFlood(benchmark::State& state)
+{
+    const auto count = int(state.range(0));
+    size_t updatesSum = 0;
+
+    while (state.KeepRunning()) {
+        QmlFutures::QmlFutureWatcher watcher;
+        size_t updates = 0;
+
+        QObject::connect(&watcher, &QmlFutures::QmlFutureWatcher::progressChanged, [&updates](){ updates++; });
+        QObject::connect(&watcher, &QmlFutures::QmlFutureWatcher::progressMaxChanged, [&updates](){ updates++; });
+
+        QFutureInterface<QVariant> interface;
+        watcher.setFuture(pendingFuture(interface));
+
+        auto worker = QtConcurrent::run([&interface, count](){
+            for (int i = 1; i <= count; i++) {
+                interface.setProgressRange(0, i);
+                interface.setProgressValue(i);
+            }
+
+            interface.reportResult(QVariant(count));
+            interface.reportFinished();
+        });
+
+        while (!watcher.isFinished())
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        worker.waitForFinished();
+        updatesSum += updates;
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["updates"] = double(updatesSum) / state.iterations();
+}
+
+BENCHMARK(QmlFutureWatcher_ProgressFlood)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+
+// QF.combine over N sources advancing their progress together, combined future reports throttled aggregate
+static void QF_CombineProgress(benchmark::State& state)
+{
+    constexpr int steps = 10;
+    auto qf = QmlFutures::QF::instance();
+    const auto count = state.range(0);
+    size_t updatesSum = 0;
+
+    while (state.KeepRunning()) {
+        std::vector<QFutureInterface<QVariant>> interfaces(count);
+        QVariantList sources;
+        sources.reserve(count);
+
+        for (auto& x : interfaces) {
+            x.setProgressRange(0, steps);
+            sources.append(pendingFuture(x));
+        }
+
+        const auto combined = qf->combine(QmlFutures::QF::CombineTrigger::All, QVariant(), sources);
+
+        QFutureWatcher<QVariant> watcher;
+        size_t updates = 0;
+        QObject::connect(&watcher, &QFutureWatcher<QVariant>::progressValueChanged, [&updates](){ updates++; });
+        watcher.setFuture(combined.value<QFuture<QVariant>>());
+
+        for (int i = 1; i <= steps; i++) {
+            for (auto& x : interfaces)
+                x.setProgressValue(i);
+
+            QCoreApplication::processEvents();
+        }
+
+        for (auto& x : interfaces) {
+            x.reportResult(QVariant(1));
+            x.reportFinished();
+        }
+
+        waitForFinished({combined});
+        QCoreApplication::processEvents();
+        updatesSum += updates;
+    }
+
+    state.SetItemsProcessed(state.iterations() * count * steps);
+    state.counters["updates"] = double(updatesSum) / state.iterations();
+}
+
+BENCHMARK(QF_CombineProgress)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+
+// Rapid rebinding of QmlFutureWatcher (search-as-you-type): new 20 ms job per input, every 2 ms.
+// Jobs poll cancellation each ms, 'wasted_ms' is work done for superseded futures
+static void QmlFutureWatcher_Supersede(benchmark::State& state)
+{
+    constexpr int inputs = 20;
+    constexpr int jobMs = 20;
+    const auto policy = QmlFutures::QF::SupersedePolicy(state.range(0));
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+    std::atomic<int> wastedMs { 0 };
+
+    while (state.KeepRunning()) {
+        QmlFutures::QmlFutureWatcher watcher;
+        watcher.setSupersedePolicy(policy);
+        std::vector<QFuture<void>> jobs;
+
+        for (int i = 0; i < inputs; i++) {
+            auto interface = std::make_shared<QFutureInterface<QVariant>>();
+            const bool superseded = (i + 1 < inputs);
+            watcher.setFuture(pendingFuture(*interface));
+
+            jobs.push_back(QtConcurrent::run(&pool, [interface, superseded, &wastedMs](){
+                for (int ms = 0; ms < jobMs && !interface->isCanceled(); ms++) {
+                    QThread::msleep(1);
+
+                    if (superseded)
+                        wastedMs++;
+                }
+
+                interface->reportResult(QVariant(1)); // Ignored if canceled
+                interface->reportFinished();
+            }));
+
+            QThread::msleep(2);
+            QCoreApplication::processEvents();
+        }
+
+        while (!watcher.isFinished())
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        for (auto& x : jobs)
+            x.waitForFinished();
+    }
+
+    state.SetItemsProcessed(state.iterations() * inputs);
+    state.counters["wasted_ms"] = double(wastedMs) / state.iterations();
+}
+
+BENCHMARK(QmlFutureWatcher_Supersede)
+    ->ArgName("policy") // 0 - Keep, 1 - Cancel
+    ->DenseRange(0, 1)
+    ->Unit(benchmark::kMillisecond);
+
+
+int main(int argc, char** argv)
+{
+    QCoreApplication app(argc, argv);
+    QQmlEngine engine;
+    QmlFutures::Init qmlFuturesInit(engine);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
 
-BENCHMARK_MAIN();
+#include "qml_futures.moc"
@@ -10,7 +10,11 @@
 #include <QSGRendererInterface>
 #include <QFuture>
 #include <QFutureInterface>
+#include <QFutureWatcher>
+#include <QTimer>
+#include <algorithm>
 #include <cassert>
+#include <memory>
 
 #include <QmlFutures/Init.h>
 
@@ -23,6 +27,7 @@ struct ComplexStructExample {
 
 Q_DECLARE_METATYPE(ComplexStructExample);
 Q_DECLARE_METATYPE(QFuture<ComplexStructExample>);
+Q_DECLARE_METATYPE(QFuture<int>); // Registered by Init, declared here for QVariant::fromValue
 
 class ComplexStructProvider : public QObject
 {
@@ -40,6 +45,162 @@ public:
     }
 };
 
+class ResultsStreamProvider : public QObject
+{
+    Q_OBJECT
+public:
+    // Reports 'count' results (i * 10) by chunks, one chunk per timer tick
+    Q_INVOKABLE QFuture<int> stream(int count, int chunk) {
+        QFutureInterface<int> futureInterface;
+        futureInterface.reportStarted();
+
+        auto timer = new QTimer(this);
+        auto next = std::make_shared<int>(0);
+
+        QObject::connect(timer, &QTimer::timeout, timer, [timer, futureInterface, next, count, chunk]() mutable {
+            for (int i = 0; i < chunk && *next < count; i++, (*next)++)
+                futureInterface.reportResult(*next * 10, *next);
+
+            if (*next >= count) {
+                futureInterface.reportFinished();
+                timer->deleteLater();
+            }
+        });
+
+        timer->start(1);
+        return futureInterface.future();
+    }
+};
+
+class ProgressProvider : public QObject
+{
+    Q_OBJECT
+public:
+    // Reports progress [0..maximum] by 'step', one step per timer tick, then "done" as text
+    Q_INVOKABLE QFuture<int> run(int maximum, int step) {
+        QFutureInterface<int> futureInterface;
+        futureInterface.reportStarted();
+        futureInterface.setProgressRange(0, maximum);
+
+        auto timer = new QTimer(this);
+        auto value = std::make_shared<int>(0);
+
+        QObject::connect(timer, &QTimer::timeout, timer, [timer, futureInterface, value, maximum, step]() mutable {
+            *value = std::min(*value + step, maximum);
+
+            if (*value < maximum) {
+                futureInterface.setProgressValue(*value);
+            } else {
+                futureInterface.setProgressValueAndText(maximum, "done");
+                futureInterface.reportResult(maximum);
+                futureInterface.reportFinished();
+                timer->deleteLater();
+            }
+        });
+
+        timer->start(1);
+        return futureInterface.future();
+    }
+};
+
+class ChainedProvider : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int chainedCalls READ chainedCalls NOTIFY chainedCallsChanged)
+public:
+    int chainedCalls() const { return m_chainedCalls; }
+
+    // Returns pending future; on next tick chains own continuation to it (as user code would do
+    // after handing it to QML), then finishes it with 'value'
+    Q_INVOKABLE QFuture<int> run(int value) {
+        QFutureInterface<int> futureInterface;
+        futureInterface.reportStarted();
+
+        QTimer::singleShot(0, this, [this, futureInterface, value]() mutable {
+#if QT_VERSION >= QT_VERSION_CHECK(6,1,0)
+            futureInterface.future().then(this, [this](int){ onChained(); });
+#else
+            auto watcher = new QFutureWatcher<int>(this);
+            QObject::connect(watcher, &QFutureWatcher<int>::finished, this, [this, watcher](){
+                watcher->deleteLater();
+                onChained();
+            });
+            watcher->setFuture(futureInterface.future());
+#endif
+
+            QTimer::singleShot(10, this, [futureInterface, value]() mutable {
+                futureInterface.reportResult(value);
+                futureInterface.reportFinished();
+            });
+        });
+
+        return futureInterface.future();
+    }
+
+    // Chains own continuation to future produced by QF
+    Q_INVOKABLE void chain(const QVariant& future) {
+        auto typedFuture = future.value<QFuture<QVariant>>();
+
+#if QT_VERSION >= QT_VERSION_CHECK(6,1,0)
+        typedFuture.then(this, [this](const QVariant&){ onChained(); });
+#else
+        auto watcher = new QFutureWatcher<QVariant>(this);
+        QObject::connect(watcher, &QFutureWatcher<QVariant>::finished, this, [this, watcher](){
+            watcher->deleteLater();
+            onChained();
+        });
+        watcher->setFuture(typedFuture);
+#endif
+    }
+
+signals:
+    void chainedCallsChanged();
+
+private:
+    void onChained() {
+        m_chainedCalls++;
+        emit chainedCallsChanged();
+    }
+
+    int m_chainedCalls { 0 };
+};
+
+class VoidFutureProvider : public QObject
+{
+    Q_OBJECT
+public:
+    // QFuture<void> finished after 'ms' (Qt5 keeps its shared state private, see FutureId)
+    Q_INVOKABLE QFuture<void> run(int ms) {
+        QFutureInterface<void> futureInterface;
+        futureInterface.reportStarted();
+
+        QTimer::singleShot(ms, this, [futureInterface]() mutable {
+            futureInterface.reportFinished();
+        });
+
+        return futureInterface.future();
+    }
+
+    // Qt5 QFuture<void> has no identity: it isn't known to share state with QFuture<T> it was made of
+    Q_INVOKABLE bool hasIdentity() const {
+        return QT_VERSION >= QT_VERSION_CHECK(6,0,0);
+    }
+
+    // [QFuture<int>, QFuture<void> converted from it]: one shared state seen through two types
+    Q_INVOKABLE QVariantList runTyped(int value, int ms) {
+        QFutureInterface<int> futureInterface;
+        futureInterface.reportStarted();
+
+        QTimer::singleShot(ms, this, [futureInterface, value]() mutable {
+            futureInterface.reportResult(value);
+            futureInterface.reportFinished();
+        });
+
+        const auto future = futureInterface.future();
+        return { QVariant::fromValue(future), QVariant::fromValue(QFuture<void>(future)) };
+    }
+};
+
 class Registrator : public QObject
 {
     Q_OBJECT
@@ -72,6 +233,26 @@ public:
             return new ComplexStructProvider();
         });
 
+        // Streaming test
+        qmlRegisterSingletonType<ResultsStreamProvider>("QmlFutures", 1, 0, "ResultsStreamProvider", [] (QQmlEngine*, QJSEngine *) -> QObject* {
+            return new ResultsStreamProvider();
+        });
+
+        // Progress test
+        qmlRegisterSingletonType<ProgressProvider>("QmlFutures", 1, 0, "ProgressProvider", [] (QQmlEngine*, QJSEngine *) -> QObject* {
+            return new ProgressProvider();
+        });
+
+        // QFuture<void> test
+        qmlRegisterSingletonType<VoidFutureProvider>("QmlFutures", 1, 0, "VoidFutureProvider", [] (QQmlEngine*, QJSEngine *) -> QObject* {
+            return new VoidFutureProvider();
+        });
+
+        // Foreign continuation test
+        qmlRegisterSingletonType<ChainedProvider>("QmlFutures", 1, 0, "ChainedProvider", [] (QQmlEngine*, QJSEngine *) -> QObject* {
+            return new ChainedProvider();
+        });
+
         QmlFutures::Init::instance()->registerType<ComplexStructExample>([](const ComplexStructExample& item) -> QVariant {
             QVariantMap result;
             result["value1"] = item.value1;
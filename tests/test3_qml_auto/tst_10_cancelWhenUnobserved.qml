@@ -0,0 +1,175 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.9
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+
+    Component {
+        id: promiseComponent
+
+        QmlPromise { }
+    }
+
+    Component {
+        id: contextComponent
+
+        Item { }
+    }
+
+    QmlFutureWatcher {
+        id: cancelingWatcher
+        cancelWhenUnobserved: true
+    }
+
+    QmlFutureWatcher {
+        id: plainWatcher
+    }
+
+    SignalSpy {
+        id: ssCancelingUninitialized
+        target: cancelingWatcher
+        signalName: "uninitialized"
+    }
+
+    TestCase {
+        name: "CancelWhenUnobservedTest"
+
+        function test_00_initial() {
+            compare(cancelingWatcher.cancelWhenUnobserved, true);
+            compare(plainWatcher.cancelWhenUnobserved, false);
+        }
+
+        function test_01_contextDied() {
+            var promise = promiseComponent.createObject();
+            var ctx = contextComponent.createObject();
+            var f = promise.future;
+
+            QmlFutures.onFinished(f, QF.conditionObj(ctx), function(){}, QF.Normal, true);
+            compare(QmlFutures.isCanceled(f), false);
+
+            ctx.destroy();
+            wait(1);
+            compare(QmlFutures.isCanceled(f), true);
+
+            promise.destroy();
+        }
+
+        function test_02_policyIsOptIn() {
+            var promise = promiseComponent.createObject();
+            var ctx = contextComponent.createObject();
+            var f = promise.future;
+
+            QmlFutures.onFinished(f, QF.conditionObj(ctx), function(){});
+
+            ctx.destroy();
+            wait(1);
+            compare(QmlFutures.isCanceled(f), false);
+
+            promise.destroy();
+        }
+
+        function test_03_lastObserver() {
+            var promise = promiseComponent.createObject();
+            var ctx = contextComponent.createObject();
+            var f = promise.future;
+
+            QmlFutures.onFulfilled(f, QF.conditionObj(ctx), function(){}, QF.Normal, true);
+            var handle = QmlFutures.onFinished(f, null, function(){});
+
+            // Another handler still observes
+            ctx.destroy();
+            wait(1);
+            compare(QmlFutures.isCanceled(f), false);
+
+            QmlFutures.unsubscribe(handle);
+            compare(QmlFutures.isCanceled(f), true);
+
+            promise.destroy();
+        }
+
+        function test_04_watcher() {
+            var promise1 = promiseComponent.createObject();
+            var promise2 = promiseComponent.createObject();
+
+            cancelingWatcher.future = promise1.future;
+            plainWatcher.future = promise2.future;
+
+            // promise2 is observed by plainWatcher
+            cancelingWatcher.future = promise2.future;
+            compare(QmlFutures.isCanceled(promise1.future), true);
+
+            cancelingWatcher.future = null;
+            compare(QmlFutures.isCanceled(promise2.future), false);
+
+            plainWatcher.future = null;
+            compare(QmlFutures.isCanceled(promise2.future), false);
+
+            promise1.destroy();
+            promise2.destroy();
+        }
+
+        function test_05_finishedIsKept() {
+            var promise = promiseComponent.createObject();
+            cancelingWatcher.future = promise.future;
+
+            promise.result = 5;
+            tryCompare(cancelingWatcher, "isFulfilled", true, 1000);
+
+            cancelingWatcher.future = null;
+            compare(QmlFutures.isFulfilled(promise.future), true);
+
+            promise.destroy();
+        }
+
+        function test_06_cascade() {
+            var promise1 = promiseComponent.createObject();
+            var promise2 = promiseComponent.createObject();
+            var promise3 = promiseComponent.createObject();
+            var ctx = contextComponent.createObject();
+
+            var combined = QF.combine(QF.All, null, [promise1.future, QF.createFuture(promise2.future, null), promise3.future]);
+            plainWatcher.future = promise3.future;
+
+            QmlFutures.onFinished(combined, QF.conditionObj(ctx), function(){}, QF.Normal, true);
+
+            ctx.destroy();
+            wait(1);
+
+            compare(QmlFutures.isCanceled(combined), true);
+            compare(QmlFutures.isCanceled(promise1.future), true);
+            compare(QmlFutures.isCanceled(promise2.future), true);
+
+            // Observed by somebody else
+            compare(QmlFutures.isCanceled(promise3.future), false);
+
+            plainWatcher.future = null;
+            promise1.destroy();
+            promise2.destroy();
+            promise3.destroy();
+        }
+
+        function test_07_sameFutureAgain() {
+            var promise = promiseComponent.createObject();
+
+            // Each read of 'promise.future' is a new copy of the same future
+            cancelingWatcher.future = promise.future;
+            ssCancelingUninitialized.clear();
+
+            cancelingWatcher.future = promise.future;
+            compare(QmlFutures.isCanceled(promise.future), false);
+            compare(cancelingWatcher.isFinished, false);
+            compare(ssCancelingUninitialized.count, 0);
+
+            promise.result = 5;
+            tryCompare(cancelingWatcher, "isFulfilled", true, 1000);
+
+            cancelingWatcher.future = null;
+            promise.destroy();
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.9
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+
+    QmlFutureWatcher {
+        id: foreignWatcher
+    }
+
+    QmlFutureWatcher {
+        id: ownWatcher
+    }
+
+    QtObject {
+        id: handlerState
+        property int result: 0
+    }
+
+    QtObject {
+        id: testObject
+        property int value: 0
+    }
+
+    TestCase {
+        name: "ForeignContinuationTest"
+
+        // Future from C++ gets continuation after QML started observing it: both must be notified
+        function test_01_watcher() {
+            var calls = ChainedProvider.chainedCalls;
+
+            foreignWatcher.future = ChainedProvider.run(42);
+            compare(foreignWatcher.isFinished, false);
+
+            tryCompare(foreignWatcher, "isFinished", true, 1000);
+            compare(foreignWatcher.result, 42);
+            tryCompare(ChainedProvider, "chainedCalls", calls + 1, 1000);
+
+            foreignWatcher.future = null;
+        }
+
+        function test_02_handler() {
+            var calls = ChainedProvider.chainedCalls;
+            handlerState.result = 0;
+
+            QmlFutures.onFinished(ChainedProvider.run(7), null, function(future, raw, conv){
+                handlerState.result = raw;
+            });
+
+            tryCompare(handlerState, "result", 7, 1000);
+            tryCompare(ChainedProvider, "chainedCalls", calls + 1, 1000);
+        }
+
+        // Future produced by QmlFutures itself, C++ chains its continuation too
+        function test_03_ownFuture() {
+            var calls = ChainedProvider.chainedCalls;
+
+            ownWatcher.future = QF.createFuture(QF.conditionProp(testObject, "value", testObject.value + 1, QF.Equal), null);
+            compare(ownWatcher.isFinished, false);
+            ChainedProvider.chain(ownWatcher.future);
+
+            testObject.value++;
+            tryCompare(ownWatcher, "isFinished", true, 1000);
+            compare(ownWatcher.isCanceled, false);
+            tryCompare(ChainedProvider, "chainedCalls", calls + 1, 1000);
+
+            ownWatcher.future = null;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.15
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+    width: 100
+    height: 100
+
+    property var futures: []
+
+    QtObject {
+        id: poolState
+        property int created: 0
+        property int pooled: 0
+        property int reused: 0
+        property int uninitialized: 0
+        property int initialized: 0
+        property int fulfilled: 0
+    }
+
+    Component {
+        id: listComponent
+
+        ListView {
+            width: 100
+            height: 100
+            cacheBuffer: 0
+            reuseItems: true
+            model: root.futures.length
+
+            delegate: Item {
+                width: 100
+                height: 20
+
+                property int row: index
+                property alias watcher: rowWatcher
+
+                ListView.onPooled: poolState.pooled++
+                ListView.onReused: poolState.reused++
+                Component.onCompleted: poolState.created++
+
+                QmlFutureWatcher {
+                    id: rowWatcher
+                    future: root.futures[index]
+                    onUninitialized: poolState.uninitialized++
+                    onInitialized: poolState.initialized++
+                    onFulfilled: poolState.fulfilled++
+                }
+            }
+        }
+    }
+
+    TestCase {
+        name: "DelegatePoolTest"
+        when: windowShown
+
+        function visibleDelegates(list) {
+            var result = [];
+            var children = list.contentItem.children;
+
+            // Pooled delegates are culled, not hidden: take the ones within viewport
+            for (var i = 0; i < children.length; i++) {
+                var child = children[i];
+                if (child.watcher !== undefined && child.y >= list.contentY && child.y < list.contentY + list.height)
+                    result.push(child);
+            }
+
+            return result;
+        }
+
+        function test_01_listViewReuseItems() {
+            var futures = [];
+            for (var i = 0; i < 50; i++)
+                futures.push(QF.createTimedFuture(i, 0));
+            root.futures = futures;
+
+            var list = listComponent.createObject(root);
+            verify(list);
+            tryCompare(poolState, "fulfilled", poolState.created, 1000);
+            verify(poolState.created > 0);
+            compare(poolState.initialized, poolState.created);
+
+            // Scroll by whole screens: delegates leave the view and are reused for new rows
+            for (var screen = 1; screen <= 3; screen++) {
+                list.contentY = screen * list.height;
+                for (var t = 0; t < 100 && poolState.reused < screen * 5; t++)
+                    wait(10);
+                verify(poolState.reused >= screen * 5);
+                wait(1);
+
+                var delegates = visibleDelegates(list);
+                verify(delegates.length > 0);
+
+                for (var j = 0; j < delegates.length; j++) {
+                    compare(delegates[j].watcher.result, delegates[j].row);
+                    compare(delegates[j].watcher.isFulfilled, true);
+                }
+            }
+
+            verify(poolState.pooled > 0);
+            verify(poolState.reused > 0);
+
+            // Reuse is a single transition: no re-initialization, one 'fulfilled' per reuse
+            compare(poolState.uninitialized, 0);
+            compare(poolState.initialized, poolState.created);
+            compare(poolState.fulfilled, poolState.created + poolState.reused);
+
+            list.destroy();
+            root.futures = [];
+        }
+    }
+}
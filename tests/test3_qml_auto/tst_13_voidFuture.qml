@@ -0,0 +1,113 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.9
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+
+    QmlFutureWatcher {
+        id: voidWatcher
+    }
+
+    QmlFutureWatcher {
+        id: voidWatcher2
+    }
+
+    SignalSpy {
+        id: ssUninitialized
+        target: voidWatcher
+        signalName: "uninitialized"
+    }
+
+    QtObject {
+        id: handlerState
+        property int calls: 0
+        property var typedResult
+        property var voidResult: "none"
+    }
+
+    TestCase {
+        name: "VoidFutureTest"
+
+        function cleanup() {
+            voidWatcher.future = null;
+            voidWatcher2.future = null;
+            voidWatcher.supersedePolicy = QF.Keep;
+        }
+
+        function test_01_sharedObservers() {
+            var f = VoidFutureProvider.run(20);
+            var other = VoidFutureProvider.run(1000);
+            handlerState.calls = 0;
+
+            voidWatcher.future = f;
+            voidWatcher2.future = other;
+            QmlFutures.onFinished(f, null, function(){ handlerState.calls++; });
+            QmlFutures.onFulfilled(f, null, function(){ handlerState.calls++; });
+
+            compare(voidWatcher.isFinished, false);
+            compare(QmlFutures.isFinished(f), false);
+
+            // Same future again: kept, not re-initialized
+            ssUninitialized.clear();
+            voidWatcher.future = f;
+            compare(ssUninitialized.count, 0);
+
+            tryCompare(voidWatcher, "isFulfilled", true, 1000);
+            tryCompare(handlerState, "calls", 2, 1000);
+            compare(QmlFutures.isFulfilled(f), true);
+
+            // Other future isn't confused with the first one
+            compare(voidWatcher2.isFinished, false);
+            compare(QmlFutures.isFinished(other), false);
+        }
+
+        function test_02_finished() {
+            var f = VoidFutureProvider.run(0);
+            QmlFutures.wait(f);
+
+            voidWatcher.future = f;
+            compare(voidWatcher.state, QF.FinishedFulfilled);
+            compare(voidWatcher.isFulfilled, true);
+        }
+
+        // QFuture<void> converted from QFuture<int> shares its state, but is observed as void
+        function test_03_typedAndVoid() {
+            var pair = VoidFutureProvider.runTyped(5, 30);
+            handlerState.typedResult = undefined;
+            handlerState.voidResult = "none";
+
+            voidWatcher.future = pair[0];
+            voidWatcher2.future = pair[1];
+            QmlFutures.onFinished(pair[0], null, function(future, raw){ handlerState.typedResult = raw; });
+            QmlFutures.onFinished(pair[1], null, function(future, raw){ handlerState.voidResult = raw; });
+
+            tryCompare(voidWatcher2, "isFulfilled", true, 1000);
+            compare(voidWatcher.isFulfilled, true);
+            compare(voidWatcher.result, 5);
+            compare(voidWatcher2.result, undefined);
+            tryCompare(handlerState, "typedResult", 5, 1000);
+            tryCompare(handlerState, "voidResult", undefined, 1000);
+        }
+
+        // Switching from typed future to its void view isn't superseding
+        function test_04_typedToVoid() {
+            if (!VoidFutureProvider.hasIdentity())
+                skip("QFuture<void> has no identity");
+
+            var pair = VoidFutureProvider.runTyped(7, 30);
+            voidWatcher.supersedePolicy = QF.Cancel;
+
+            voidWatcher.future = pair[0];
+            voidWatcher.future = pair[1];
+            compare(QmlFutures.isCanceled(pair[1]), false);
+
+            tryCompare(voidWatcher, "isFulfilled", true, 1000);
+            compare(voidWatcher.result, undefined);
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.9
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+
+    readonly property var signalNames: ["futureChanged", "stateChanged", "isFinishedChanged", "isCanceledChanged",
+                                        "isFulfilledChanged", "resultChanged", "resultConvertedChanged",
+                                        "uninitialized", "initialized", "started", "finished", "fulfilled", "canceled"]
+    property var counts: ({})
+
+    function hit(name) {
+        counts[name] = (counts[name] || 0) + 1;
+    }
+
+    QmlFutureWatcher {
+        id: watcher
+
+        onFutureChanged: root.hit("futureChanged")
+        onStateChanged: root.hit("stateChanged")
+        onIsFinishedChanged: root.hit("isFinishedChanged")
+        onIsCanceledChanged: root.hit("isCanceledChanged")
+        onIsFulfilledChanged: root.hit("isFulfilledChanged")
+        onResultChanged: root.hit("resultChanged")
+        onResultConvertedChanged: root.hit("resultConvertedChanged")
+        onUninitialized: root.hit("uninitialized")
+        onInitialized: root.hit("initialized")
+        onStarted: root.hit("started")
+        onFinished: root.hit("finished")
+        onFulfilled: root.hit("fulfilled")
+        onCanceled: root.hit("canceled")
+    }
+
+    TestCase {
+        name: "RebindSignalsTest"
+
+        // Signals not listed in 'expected' must not be emitted
+        function checkCounts(expected) {
+            for (var i = 0; i < signalNames.length; i++) {
+                var name = signalNames[i];
+                compare(counts[name] || 0, expected[name] || 0, name);
+            }
+
+            counts = {};
+        }
+
+        function test_01_notifyCounts() {
+            counts = {};
+
+            // Initial set
+            watcher.future = QF.createTimedFuture("first", 30);
+            compare(watcher.state, QF.Running);
+            checkCounts({ initialized: 1, futureChanged: 1, stateChanged: 1, started: 1 });
+
+            // Running -> running: single transition, state is the same
+            watcher.future = QF.createTimedFuture("second", 30);
+            compare(watcher.state, QF.Running);
+            checkCounts({ futureChanged: 1, started: 1 });
+
+            // Completion
+            tryCompare(watcher, "isFulfilled", true, 1000);
+            compare(watcher.result, "second");
+            checkCounts({ stateChanged: 2, isFinishedChanged: 1, isFulfilledChanged: 1,
+                          resultChanged: 1, resultConvertedChanged: 1, finished: 1, fulfilled: 1 });
+
+            // Finished -> finished: flags are kept, result is replaced
+            watcher.future = QF.createTimedFuture("third", 0);
+            compare(watcher.result, "third");
+            checkCounts({ futureChanged: 1, resultChanged: 1, resultConvertedChanged: 1, finished: 1, fulfilled: 1 });
+
+            // Finished -> running
+            watcher.future = QF.createTimedFuture("fourth", 1000);
+            compare(watcher.state, QF.Running);
+            compare(watcher.result, undefined);
+            checkCounts({ futureChanged: 1, stateChanged: 1, isFinishedChanged: 1, isFulfilledChanged: 1,
+                          resultChanged: 1, resultConvertedChanged: 1, started: 1 });
+
+            // Reset
+            watcher.future = null;
+            compare(watcher.state, QF.Uninitialized);
+            checkCounts({ futureChanged: 1, stateChanged: 1, uninitialized: 1 });
+        }
+    }
+}
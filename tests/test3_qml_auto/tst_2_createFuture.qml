@@ -509,5 +509,143 @@ Item {
             compare(ssFulfilled.count, 0);
             compare(ssCanceled.count, 1);
         }
+
+        function test_15_deliveryMode() {
+            compare(futureWatcher2.deliveryMode, QF.Queued);
+
+            var modes = [QF.Queued, QF.Direct, QF.Coalesced];
+
+            for (var i = 0; i < modes.length; i++) {
+                futureWatcher2.future = null;
+                futureWatcher2.deliveryMode = modes[i];
+                compare(futureWatcher2.deliveryMode, modes[i]);
+
+                signalSpiesHolder.target = null;
+                signalSpiesHolder.target = futureWatcher2;
+
+                futureWatcher2.future = QF.createTimedFuture("myString", 30);
+
+                ssFulfilled.wait(200);
+
+                compare(futureWatcher2.state, QF.FinishedFulfilled);
+                compare(futureWatcher2.result, "myString");
+                compare(ssFinished.count, 1);
+                compare(ssFulfilled.count, 1);
+                compare(ssCanceled.count, 0);
+                verify(ssStarted.count <= 1);
+            }
+
+            futureWatcher2.future = null;
+            futureWatcher2.deliveryMode = QF.Queued;
+            signalSpiesHolder.target = futureWatcher;
+        }
+
+        function test_16_reuse() {
+            futureWatcher2.future = QF.createTimedFuture("first", 10);
+            tryCompare(futureWatcher2, "state", QF.FinishedFulfilled, 200);
+
+            signalSpiesHolder.target = null;
+            signalSpiesHolder.target = futureWatcher2;
+
+            // Dormant while pooled
+            futureWatcher2.pool();
+            futureWatcher2.future = QF.createTimedFuture("second", 10);
+            wait(50);
+
+            compare(futureWatcher2.result, "first");
+            compare(ssFulfilled.count, 0);
+
+            // Finished future: one transition, no re-initialization
+            futureWatcher2.reuse();
+
+            compare(futureWatcher2.state, QF.FinishedFulfilled);
+            compare(futureWatcher2.result, "second");
+            compare(futureWatcher2.isFulfilled, true);
+            compare(ssUninitialized.count, 0);
+            compare(ssInitialized.count, 0);
+            compare(ssFinished.count, 1);
+            compare(ssFulfilled.count, 1);
+            compare(ssCanceled.count, 0);
+
+            // Pending future: watcher follows it after reuse
+            futureWatcher2.pool();
+            futureWatcher2.future = QF.createTimedFuture("third", 50);
+            futureWatcher2.reuse();
+
+            compare(futureWatcher2.isFinished, false);
+            compare(futureWatcher2.result, undefined);
+
+            ssFulfilled.wait(200);
+
+            compare(futureWatcher2.state, QF.FinishedFulfilled);
+            compare(futureWatcher2.result, "third");
+            compare(ssUninitialized.count, 0);
+            compare(ssInitialized.count, 0);
+            compare(ssFulfilled.count, 2);
+
+            futureWatcher2.future = null;
+            signalSpiesHolder.target = futureWatcher;
+        }
+
+        function test_17_supersedePolicy() {
+            compare(futureWatcher2.supersedePolicy, QF.Keep);
+
+            var f1 = QF.createTimedFuture("first", 1000);
+            var f2 = QF.createTimedFuture("second", 1000);
+            futureWatcher2.future = f1;
+            futureWatcher2.future = f2;
+            compare(QmlFutures.isCanceled(f1), false);
+
+            futureWatcher2.supersedePolicy = QF.Cancel;
+            compare(futureWatcher2.supersedePolicy, QF.Cancel);
+
+            // Latest-only
+            var f3 = QF.createTimedFuture("third", 20);
+            futureWatcher2.future = f3;
+            compare(QmlFutures.isCanceled(f2), true);
+
+            // Finished future is kept
+            tryCompare(futureWatcher2, "isFulfilled", true, 1000);
+            var source = QF.createTimedFuture("source", 1000);
+            var f4 = QF.combine(QF.All, null, [source]);
+            futureWatcher2.future = f4;
+            compare(QmlFutures.isFulfilled(f3), true);
+
+            // Superseded future is canceled even if observed by others, its sources too
+            futureWatcher.future = f4;
+            futureWatcher2.future = QF.createTimedFuture("fifth", 1000);
+            compare(QmlFutures.isCanceled(f4), true);
+            compare(QmlFutures.isCanceled(source), true);
+            tryCompare(futureWatcher, "isCanceled", true, 1000);
+
+            // Reset to null doesn't cancel
+            var f5 = futureWatcher2.future;
+            futureWatcher2.future = null;
+            compare(QmlFutures.isCanceled(f5), false);
+
+            futureWatcher.future = null;
+            futureWatcher2.supersedePolicy = QF.Keep;
+        }
+
+        function test_18_supersedeSameFuture() {
+            futureWatcher2.supersedePolicy = QF.Cancel;
+
+            var f = QF.createTimedFuture("same", 50);
+            futureWatcher2.future = f;
+            futureWatcher2.future = f;
+            compare(QmlFutures.isCanceled(f), false);
+
+            // Same future through delegate pool
+            futureWatcher2.pool();
+            futureWatcher2.future = f;
+            futureWatcher2.reuse();
+            compare(QmlFutures.isCanceled(f), false);
+
+            tryCompare(futureWatcher2, "isFulfilled", true, 1000);
+            compare(futureWatcher2.result, "same");
+
+            futureWatcher2.future = null;
+            futureWatcher2.supersedePolicy = QF.Keep;
+        }
     }
 }
@@ -23,6 +23,11 @@ Item {
     TestCase {
         name: "QmlFuturesTest"
 
+        // Global settings changed by a test mustn't leak into the next one, even if it fails
+        function cleanup() {
+            QmlFutures.dispatchBudget = 0;
+        }
+
         function test_00_initial() {
         }
 
@@ -186,5 +191,102 @@ Item {
 
             compare(value, 0);
         }
+
+        function test_11_dispatchBudget() {
+            var order = [];
+
+            QmlFutures.dispatchBudget = 4;
+            QmlFutures.resetDispatchStats();
+
+            var f = QF.createTimedFuture(1, 17);
+            QmlFutures.onFinished(f, null, function(){ order.push("idle"); }, QF.Idle);
+            QmlFutures.onFinished(f, null, function(){ order.push("normal"); }, QF.Normal);
+            QmlFutures.onFinished(f, null, function(){ order.push("immediate"); }, QF.Immediate);
+
+            QmlFutures.wait(f);
+            compare(order, ["immediate"]);
+
+            tryCompare(order, "length", 3);
+            compare(order, ["immediate", "normal", "idle"]);
+
+            var stats = QmlFutures.dispatchStats();
+            compare(stats.pending, 0);
+            compare(stats.latency.reduce(function(a, b){ return a + b; }, 0), 2);
+        }
+
+        function test_12_unsubscribe() {
+            var value = 0;
+
+            var f = QF.createTimedFuture(1, 17);
+            var h1 = QmlFutures.onFinished(f, null, function(){ value += 1; });
+            var h2 = QmlFutures.onFulfilled(f, QF.conditionProp(testObject, "value", 20, QF.Equal), function(){ value += 10; });
+            var h3 = QmlFutures.onFinished(f, null, function(){ value += 100; });
+
+            verify(h1 !== 0 && h2 !== 0 && h3 !== 0);
+            verify(h1 !== h2 && h2 !== h3);
+
+            compare(QmlFutures.unsubscribe(h2), true);
+            compare(QmlFutures.unsubscribe(h2), false);
+            compare(QmlFutures.unsubscribe(h3), true);
+
+            QmlFutures.wait(f);
+            compare(value, 1);
+            compare(QmlFutures.unsubscribe(h1), false);
+
+            // Finished future: handler is called right away, nothing to unsubscribe
+            compare(QmlFutures.onFinished(f, null, function(){ value += 1000; }), 0);
+            compare(value, 1001);
+        }
+
+        function test_13_bulk() {
+            var finished = 0;
+            var canceled = 0;
+
+            var futures = [QF.createTimedFuture(1, 17), QF.createTimedFuture(2, 0), QF.createTimedCanceledFuture(17)];
+
+            compare(QmlFutures.statesOf(futures), [QF.Running, QF.FinishedFulfilled, QF.Running]);
+
+            var handles = QmlFutures.onEachFinished(futures, null, function(){ finished++; });
+            compare(handles.length, 3);
+            verify(handles[0] !== 0 && handles[1] === 0 && handles[2] !== 0);
+            compare(finished, 1);
+
+            QmlFutures.onEachCanceled(futures, null, function(){ canceled++; });
+
+            QmlFutures.wait(futures[0]);
+            QmlFutures.wait(futures[2]);
+
+            compare(finished, 3);
+            compare(canceled, 1);
+            compare(QmlFutures.statesOf(futures), [QF.FinishedFulfilled, QF.FinishedFulfilled, QF.FinishedCanceled]);
+            compare(QmlFutures.resultsRawOf(futures), [1, 2, undefined]);
+            compare(QmlFutures.resultsConvOf(futures), [1, 2, undefined]);
+        }
+
+        // Finished future, but handler is queued: it can still be unsubscribed
+        function test_14_unsubscribeQueued() {
+            var value = 0;
+            var f = QF.createTimedFuture(1, 0);
+
+            QmlFutures.dispatchBudget = 4;
+
+            var h1 = QmlFutures.onFinished(f, null, function(){ value += 1; });
+            var h2 = QmlFutures.onFulfilled(f, null, function(){ value += 10; });
+            var h3 = QmlFutures.onFinished(f, null, function(){ value += 100; }, QF.Immediate);
+
+            verify(h1 !== 0 && h2 !== 0 && h1 !== h2);
+            compare(h3, 0);
+            compare(value, 100);
+
+            compare(QmlFutures.unsubscribe(h2), true);
+            compare(QmlFutures.unsubscribe(h2), false);
+
+            for (var t = 0; t < 100 && QmlFutures.dispatchStats().pending > 0; t++)
+                wait(10);
+
+            compare(QmlFutures.dispatchStats().pending, 0);
+            compare(value, 101);
+            compare(QmlFutures.unsubscribe(h1), false);
+        }
     }
 }
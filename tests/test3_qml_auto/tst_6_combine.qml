@@ -15,6 +15,11 @@ Item {
         Item { property int value: 0 }
     }
 
+    QmlFutureWatcher {
+        id: combinedWatcher
+        progressRate: 0
+    }
+
     TestCase {
         name: "CombineTest"
 
@@ -249,5 +254,45 @@ Item {
             obj1.destroy();
             obj2.destroy();
         }
+
+        function test_10_progress_conditions() {
+            var obj1 = comp.createObject();
+            var obj2 = comp.createObject();
+            var cond1 = QF.conditionProp(obj1, "value", 1, QF.Equal);
+            var cond2 = QF.conditionProp(obj2, "value", 1, QF.Equal);
+
+            combinedWatcher.future = QF.combine(QF.All, null, [cond1, cond2]);
+            compare(combinedWatcher.progressMax, 1000);
+            compare(combinedWatcher.progress, 0);
+
+            obj1.value = 1;
+            tryCompare(combinedWatcher, "progress", 500, 1000);
+
+            obj2.value = 1;
+            tryCompare(combinedWatcher, "isFulfilled", true, 1000);
+            compare(combinedWatcher.progress, 1000);
+
+            combinedWatcher.future = null;
+            obj1.destroy();
+            obj2.destroy();
+        }
+
+        function test_11_progress_weights() {
+            var f1 = ProgressProvider.run(50, 1);
+            var f2 = QF.createTimedFuture(null, 1500);
+
+            combinedWatcher.future = QF.combine(QF.All, null, [f1, f2], [3, 1]);
+            compare(combinedWatcher.isFinished, false);
+
+            // f1 is done, f2 is not
+            tryCompare(combinedWatcher, "progress", 750, 1500);
+            compare(combinedWatcher.isFinished, false);
+
+            QmlFutures.wait(f2);
+            tryCompare(combinedWatcher, "isFulfilled", true, 1000);
+            compare(combinedWatcher.progress, 1000);
+
+            combinedWatcher.future = null;
+        }
     }
 }
@@ -0,0 +1,112 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.9
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+
+    Component {
+        id: promiseComponent
+
+        QmlPromise { }
+    }
+
+    FutureListModel {
+        id: futureModel
+    }
+
+    SignalSpy {
+        id: ssDataChanged
+        target: futureModel
+        signalName: "dataChanged"
+    }
+
+    TestCase {
+        name: "FutureListModelTest"
+
+        function roleOf(row, role) {
+            return futureModel.data(futureModel.index(row, 0), role);
+        }
+
+        function test_00_initial() {
+            compare(futureModel.count, 0);
+            compare(futureModel.updateInterval, 0);
+        }
+
+        function test_01_roles() {
+            var promises = [];
+            var futures = [];
+
+            for (var i = 0; i < 5; i++) {
+                promises.push(promiseComponent.createObject());
+                futures.push(promises[i].future);
+            }
+
+            futureModel.appendAll(futures);
+            compare(futureModel.count, 5);
+            compare(roleOf(0, FutureListModel.IsFinishedRole), false);
+            compare(roleOf(0, FutureListModel.ResultRole), undefined);
+            compare(roleOf(0, FutureListModel.ProgressRole), 0);
+
+            promises[0].result = 10;
+            promises[4].cancel = true;
+
+            compare(roleOf(0, FutureListModel.StateRole), QF.FinishedFulfilled);
+            compare(roleOf(0, FutureListModel.ResultRole), 10);
+            compare(roleOf(0, FutureListModel.ResultConvertedRole), 10);
+            compare(roleOf(0, FutureListModel.IsFinishedRole), true);
+            compare(roleOf(0, FutureListModel.ProgressRole), 1);
+            compare(roleOf(4, FutureListModel.StateRole), QF.FinishedCanceled);
+            compare(roleOf(4, FutureListModel.ResultRole), undefined);
+
+            futureModel.clear();
+            compare(futureModel.count, 0);
+
+            for (i = 0; i < promises.length; i++)
+                promises[i].destroy();
+        }
+
+        function test_02_coalescedRanges() {
+            var promises = [];
+            var futures = [];
+
+            for (var i = 0; i < 10; i++) {
+                promises.push(promiseComponent.createObject());
+                futures.push(promises[i].future);
+            }
+
+            futureModel.appendAll(futures);
+            wait(10);
+            ssDataChanged.clear();
+
+            // Rows 2..5 and 8 finish in the same batch
+            for (i = 2; i <= 5; i++)
+                promises[i].result = i;
+            promises[8].result = 8;
+
+            tryCompare(ssDataChanged, "count", 2, 200);
+            compare(ssDataChanged.signalArguments[0][0].row, 2);
+            compare(ssDataChanged.signalArguments[0][1].row, 5);
+            compare(ssDataChanged.signalArguments[1][0].row, 8);
+            compare(ssDataChanged.signalArguments[1][1].row, 8);
+
+            // Removed rows don't report
+            ssDataChanged.clear();
+            futureModel.remove(0, 2);
+            compare(futureModel.count, 8);
+            promises[0].result = 0;
+            wait(10);
+            compare(ssDataChanged.count, 0);
+            compare(roleOf(0, FutureListModel.ResultRole), 2);
+
+            futureModel.clear();
+
+            for (i = 0; i < promises.length; i++)
+                promises[i].destroy();
+        }
+    }
+}
@@ -0,0 +1,146 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.9
+import QtQuick.Window 2.2
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+
+    QmlFutureWatcher {
+        id: streamWatcher
+
+        property var received: []
+        property int batches: 0
+        property int receivedOnFinish: -1
+
+        onResultsReady: {
+            compare(startIndex, received.length);
+            compare(results.length, resultsConverted.length);
+            received = received.concat(results);
+            batches++;
+        }
+
+        onFinished: receivedOnFinish = received.length;
+    }
+
+    QtObject {
+        id: streamState
+        property int receivedOnFinish: -1
+        property int receivedCount: 0
+    }
+
+    // Never shown: no frames, so dispatched handlers stay queued until window is unset
+    Window {
+        id: hiddenWindow
+        visible: false
+    }
+
+    TestCase {
+        name: "ResultsStreamTest"
+
+        function cleanup() {
+            QmlFutures.dispatchWindow = null;
+            QmlFutures.dispatchBudget = 0;
+        }
+
+        function test_01_watcher() {
+            streamWatcher.received = [];
+            streamWatcher.batches = 0;
+            streamWatcher.receivedOnFinish = -1;
+
+            streamWatcher.future = ResultsStreamProvider.stream(100, 10);
+            tryCompare(streamWatcher, "isFinished", true, 1000);
+
+            compare(streamWatcher.receivedOnFinish, 100);
+            compare(streamWatcher.received.length, 100);
+            verify(streamWatcher.batches >= 1 && streamWatcher.batches <= 10);
+
+            for (var i = 0; i < 100; i++)
+                compare(streamWatcher.received[i], i * 10);
+
+            streamWatcher.future = null;
+        }
+
+        function test_02_qmlFutures() {
+            var received = [];
+            var f = ResultsStreamProvider.stream(50, 5);
+
+            QmlFutures.onResultsReady(f, null, function(future, startIndex, results, resultsConverted) {
+                compare(startIndex, received.length);
+                received = received.concat(resultsConverted);
+            });
+
+            streamState.receivedOnFinish = -1;
+            QmlFutures.onFinished(f, null, function() { streamState.receivedOnFinish = received.length; });
+
+            tryCompare(streamState, "receivedOnFinish", 50, 1000);
+            compare(received[49], 490);
+        }
+
+        function test_03_finished() {
+            var f = ResultsStreamProvider.stream(20, 20);
+            QmlFutures.wait(f);
+
+            var batches = 0;
+            var received = [];
+
+            QmlFutures.onResultsReady(f, null, function(future, startIndex, results) {
+                compare(startIndex, 0);
+                received = results;
+                batches++;
+            });
+
+            compare(batches, 1);
+            compare(received.length, 20);
+        }
+
+        // Several batches of one subscription are queued at once: all of them are delivered
+        function test_04_dispatchBudget() {
+            QmlFutures.dispatchBudget = 50;
+            QmlFutures.dispatchWindow = hiddenWindow;
+
+            var received = [];
+            var f = ResultsStreamProvider.stream(100, 10);
+            streamState.receivedCount = 0;
+
+            QmlFutures.onResultsReady(f, null, function(future, startIndex, results) {
+                compare(startIndex, received.length);
+                received = received.concat(results);
+                streamState.receivedCount = received.length;
+            });
+
+            QmlFutures.wait(f);
+            compare(received.length, 0);
+            verify(QmlFutures.dispatchStats().pending >= 2);
+
+            QmlFutures.dispatchWindow = null;
+            tryCompare(streamState, "receivedCount", 100, 1000);
+            compare(received[99], 990);
+        }
+
+        function test_05_dispatchBudgetUnsubscribe() {
+            QmlFutures.dispatchBudget = 50;
+            QmlFutures.dispatchWindow = hiddenWindow;
+
+            var calls = 0;
+            var f = ResultsStreamProvider.stream(100, 10);
+            var h = QmlFutures.onResultsReady(f, null, function() { calls++; });
+
+            QmlFutures.wait(f);
+            verify(QmlFutures.dispatchStats().pending >= 2);
+
+            // All queued batches are dropped
+            compare(QmlFutures.unsubscribe(h), true);
+            QmlFutures.dispatchWindow = null;
+            for (var t = 0; t < 100 && QmlFutures.dispatchStats().pending > 0; t++)
+                wait(10);
+
+            compare(QmlFutures.dispatchStats().pending, 0);
+            compare(calls, 0);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/QmlFutures
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+import QtQuick 2.9
+import QtTest 1.0
+import QmlFutures 1.0
+
+Item {
+    id: root
+
+    QmlFutureWatcher {
+        id: progressWatcher
+        progressRate: 5
+    }
+
+    SignalSpy {
+        id: ssProgress
+        target: progressWatcher
+        signalName: "progressChanged"
+    }
+
+    QtObject {
+        id: progressState
+        property int calls: 0
+        property int lastValue: -1
+        property string lastText
+    }
+
+    TestCase {
+        name: "ProgressTest"
+
+        // Global settings changed by a test mustn't leak into the next one, even if it fails
+        function cleanup() {
+            progressWatcher.future = null;
+            QmlFutures.progressRate = 30;
+        }
+
+        // Throttled to 'rate' per second: leading and trailing update plus one per elapsed period
+        function maxUpdates(elapsedMs, rate) {
+            return Math.ceil(elapsedMs * rate / 1000) + 2;
+        }
+
+        function test_00_initial() {
+            compare(progressWatcher.progress, 0);
+            compare(progressWatcher.progressMin, 0);
+            compare(progressWatcher.progressMax, 0);
+            compare(progressWatcher.progressText, "");
+            compare(progressWatcher.progressRate, 5);
+            compare(QmlFutures.progressRate, 30);
+        }
+
+        function test_01_watcher() {
+            ssProgress.clear();
+            var startedAt = Date.now();
+            progressWatcher.future = ProgressProvider.run(300, 1);
+            tryCompare(progressWatcher, "isFinished", true, 5000);
+            var elapsed = Date.now() - startedAt;
+
+            // Final progress is reported before 'finished'
+            compare(progressWatcher.progress, 300);
+            compare(progressWatcher.progressMax, 300);
+            compare(progressWatcher.progressText, "done");
+
+            // At least 300 ms of changes at 5 Hz
+            verify(ssProgress.count >= 2);
+            verify(ssProgress.count <= maxUpdates(elapsed, 5), "count: " + ssProgress.count + ", elapsed: " + elapsed);
+
+            progressWatcher.future = null;
+            compare(progressWatcher.progress, 0);
+            compare(progressWatcher.progressText, "");
+        }
+
+        function test_02_qmlFutures() {
+            progressState.calls = 0;
+            progressState.lastValue = -1;
+            progressState.lastText = "";
+
+            QmlFutures.progressRate = 5;
+
+            var startedAt = Date.now();
+            var f = ProgressProvider.run(300, 1);
+
+            QmlFutures.onProgress(f, null, function(future, value, minimum, maximum, text) {
+                compare(minimum, 0);
+                compare(maximum, 300);
+                progressState.calls++;
+                progressState.lastValue = value;
+                progressState.lastText = text;
+            });
+
+            tryCompare(progressState, "lastText", "done", 5000);
+            var elapsed = Date.now() - startedAt;
+
+            compare(progressState.lastValue, 300);
+            verify(progressState.calls <= maxUpdates(elapsed, 5), "calls: " + progressState.calls + ", elapsed: " + elapsed);
+        }
+
+        function test_03_finishedFuture() {
+            var f = ProgressProvider.run(10, 5);
+            QmlFutures.wait(f);
+
+            progressState.calls = 0;
+            progressState.lastValue = -1;
+            progressState.lastText = "";
+
+            // Final progress only
+            QmlFutures.onProgress(f, null, function(future, value, minimum, maximum, text) {
+                compare(maximum, 10);
+                progressState.calls++;
+                progressState.lastValue = value;
+                progressState.lastText = text;
+            });
+
+            tryCompare(progressState, "lastText", "done", 1000);
+            compare(progressState.lastValue, 10);
+            compare(progressState.calls, 1);
+        }
+    }
+}